@@ -15,6 +15,8 @@
  */
 
 #include <android-base/file.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <android-base/logging.h>
 #include <android-base/stringprintf.h>
 
@@ -48,6 +50,25 @@ const std::map<std::string, TracingConfig> kTracingMap = {
         },
 };
 
+bool AtraceDevice::writeTracingEnable(const std::string& path, const char* value) {
+    auto it = enable_fd_cache_.find(path);
+    if (it == enable_fd_cache_.end()) {
+        ::android::base::unique_fd fd(
+                TEMP_FAILURE_RETRY(open(path.c_str(), O_WRONLY | O_CLOEXEC)));
+        if (fd.get() < 0) {
+            return false;
+        }
+        it = enable_fd_cache_.emplace(path, std::move(fd)).first;
+    }
+    if (lseek(it->second.get(), 0, SEEK_SET) < 0 ||
+        TEMP_FAILURE_RETRY(write(it->second.get(), value, 1)) != 1) {
+        // Drop a stale fd (e.g. tracefs remounted); the next call reopens.
+        enable_fd_cache_.erase(it);
+        return false;
+    }
+    return true;
+}
+
 // Methods from ::android::hardware::atrace::V1_0::IAtraceDevice follow.
 Return<void> AtraceDevice::listCategories(listCategories_cb _hidl_cb) {
     hidl_vec<TracingCategory> categories;
@@ -85,7 +106,7 @@ Return<::android::hardware::atrace::V1_0::Status> AtraceDevice::enableCategories
             for (auto& p : kTracingMap.at(c).paths) {
                 std::string tracefs_event_enable_path = android::base::StringPrintf(
                         "%s%s/enable", tracefs_event_root_.c_str(), p.first.c_str());
-                if (!android::base::WriteStringToFile("1", tracefs_event_enable_path)) {
+                if (!writeTracingEnable(tracefs_event_enable_path, "1")) {
                     LOG(ERROR) << "Failed to enable tracing on: " << tracefs_event_enable_path;
                     if (p.second) {
                         // disable before return
@@ -108,7 +129,7 @@ Return<::android::hardware::atrace::V1_0::Status> AtraceDevice::disableAllCatego
         for (auto& p : c.second.paths) {
             std::string tracefs_event_enable_path = android::base::StringPrintf(
                     "%s%s/enable", tracefs_event_root_.c_str(), p.first.c_str());
-            if (!android::base::WriteStringToFile("0", tracefs_event_enable_path)) {
+            if (!writeTracingEnable(tracefs_event_enable_path, "0")) {
                 LOG(ERROR) << "Failed to disable tracing on: " << tracefs_event_enable_path;
                 if (p.second) {
                     ret = Status::ERROR_TRACING_POINT;
@@ -17,6 +17,9 @@
 #ifndef ANDROID_HARDWARE_ATRACE_V1_0_ATRACEDEVICE_H
 #define ANDROID_HARDWARE_ATRACE_V1_0_ATRACEDEVICE_H
 
+#include <android-base/unique_fd.h>
+
+#include <map>
 #include <android/hardware/atrace/1.0/IAtraceDevice.h>
 #include <hidl/MQDescriptor.h>
 #include <hidl/Status.h>
@@ -44,7 +47,13 @@ struct AtraceDevice : public IAtraceDevice {
     Return<::android::hardware::atrace::V1_0::Status> disableAllCategories() override;
 
   private:
+    // Writes "0"/"1" to the tracepoint enable file, keeping the fd open across calls so that
+    // toggling categories around every measured scenario costs one write syscall per
+    // tracepoint instead of an open/write/close triple.
+    bool writeTracingEnable(const std::string& path, const char* value);
+
     std::string tracefs_event_root_;
+    std::map<std::string, ::android::base::unique_fd> enable_fd_cache_;
 
     // Methods from ::android::hidl::base::V1_0::IBase follow.
 };
@@ -16,13 +16,19 @@
 
 #include <fcntl.h>
 #include <inttypes.h>
+#include <stdio.h>
 #include <unistd.h>
 
+#include <cstring>
+
 #include <functional>
 #include <unordered_map>
 
 #define LOG_TAG "AHAL_ApmXmlConverter"
+#include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android/binder_parcel.h>
+#include <android/binder_parcel_utils.h>
 
 #include <aidl/android/media/audio/common/AudioHalEngineConfig.h>
 #include <media/stagefright/foundation/MediaDefs.h>
@@ -46,6 +52,83 @@ static const int kDefaultVolumeIndexMin = 0;
 static const int kDefaultVolumeIndexMax = 100;
 static const int KVolumeIndexDeferredToAudioService = -1;
 
+namespace {
+
+// Binary cache of the converted audio policy configuration. The cache stores the fully
+// converted AIDL artifacts (module configurations, engine config, surround sound config)
+// marshalled through a binder parcel, prefixed with a checksum of the XML content it was
+// generated from. Bump the version in the magic whenever the layout changes.
+constexpr char kCacheMagic[8] = {'A', 'P', 'M', 'C', 'F', 'G', '0', '1'};
+// The directory must be writable by the audio HAL; if it does not exist or is not accessible,
+// caching is silently disabled and the XML is parsed as before.
+constexpr char kCachePath[] = "/data/vendor/audio/audio_policy_config.cache";
+
+struct CacheHeader {
+    char magic[8];
+    uint64_t contentChecksum;
+    uint32_t payloadSize;
+};
+
+struct AParcelDeleter {
+    void operator()(AParcel* parcel) { AParcel_delete(parcel); }
+};
+using ScopedAParcel = std::unique_ptr<AParcel, AParcelDeleter>;
+
+uint64_t contentChecksum(const std::string& content) {
+    // FNV-1a; this only needs to detect stale caches, both files live in trusted storage.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : content) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+#define RETURN_FALSE_IF_PARCEL_ERROR(op)                     \
+    do {                                                     \
+        if (binder_status_t _status = (op); _status != STATUS_OK) return false; \
+    } while (0)
+
+bool writeModuleConfigurationToParcel(
+        AParcel* parcel, const aidl::android::hardware::audio::core::Module::Configuration& c) {
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, c.ports));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, c.portConfigs));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, c.initialConfigs));
+    RETURN_FALSE_IF_PARCEL_ERROR(
+            AParcel_writeInt32(parcel, static_cast<int32_t>(c.connectedProfiles.size())));
+    for (const auto& [portId, profiles] : c.connectedProfiles) {
+        RETURN_FALSE_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, portId));
+        RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, profiles));
+    }
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, c.routes));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_writeVector(parcel, c.patches));
+    RETURN_FALSE_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, c.nextPortId));
+    RETURN_FALSE_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, c.nextPatchId));
+    return true;
+}
+
+bool readModuleConfigurationFromParcel(
+        const AParcel* parcel, aidl::android::hardware::audio::core::Module::Configuration* c) {
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->ports));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->portConfigs));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->initialConfigs));
+    int32_t profileCount = 0;
+    RETURN_FALSE_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &profileCount));
+    if (profileCount < 0) return false;
+    for (int32_t i = 0; i < profileCount; ++i) {
+        int32_t portId = 0;
+        RETURN_FALSE_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &portId));
+        RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->connectedProfiles[portId]));
+    }
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->routes));
+    RETURN_FALSE_IF_PARCEL_ERROR(ndk::AParcel_readVector(parcel, &c->patches));
+    RETURN_FALSE_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &c->nextPortId));
+    RETURN_FALSE_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &c->nextPatchId));
+    return true;
+}
+
+}  // namespace
+
 ConversionResult<AudioHalVolumeCurve> AudioPolicyConfigXmlConverter::convertVolumeCurveToAidl(
         const ap_xsd::Volume& xsdcVolumeCurve) {
     AudioHalVolumeCurve aidlVolumeCurve;
@@ -75,6 +158,9 @@ void AudioPolicyConfigXmlConverter::mapStreamToVolumeCurve(const ap_xsd::Volume&
 
 const SurroundSoundConfig& AudioPolicyConfigXmlConverter::getSurroundSoundConfig() {
     static const SurroundSoundConfig aidlSurroundSoundConfig = [this]() {
+        if (mSurroundConfigFromCache) {
+            return *mSurroundConfigFromCache;
+        }
         if (auto xsdcConfig = getXsdcConfig(); xsdcConfig && xsdcConfig->hasSurroundSound()) {
             auto configConv = xsdc2aidl_SurroundSoundConfig(*xsdcConfig->getFirstSurroundSound());
             if (configConv.ok()) {
@@ -176,6 +262,133 @@ void AudioPolicyConfigXmlConverter::parseVolumes() {
     }
 }
 
+AudioPolicyConfigXmlConverter::AudioPolicyConfigXmlConverter(const std::string& configFilePath) {
+    if (maybeLoadFromCache(configFilePath)) {
+        mLoadedFromCache = true;
+        LOG(DEBUG) << __func__ << ": loaded converted audio policy config from cache";
+        return;
+    }
+    mConverter.emplace(configFilePath, &ap_xsd::read);
+    if (getXsdcConfig()) {
+        init();
+        maybeSaveToCache(configFilePath);
+    }
+}
+
+bool AudioPolicyConfigXmlConverter::maybeLoadFromCache(const std::string& configFilePath) {
+    std::string xmlContent;
+    if (!::android::base::ReadFileToString(configFilePath, &xmlContent)) {
+        return false;
+    }
+    std::string cacheContent;
+    if (!::android::base::ReadFileToString(kCachePath, &cacheContent)) {
+        return false;
+    }
+    if (cacheContent.size() < sizeof(CacheHeader)) {
+        return false;
+    }
+    CacheHeader header;
+    memcpy(&header, cacheContent.data(), sizeof(CacheHeader));
+    if (memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 ||
+        header.contentChecksum != contentChecksum(xmlContent) ||
+        cacheContent.size() - sizeof(CacheHeader) != header.payloadSize) {
+        return false;
+    }
+
+    ScopedAParcel parcel(AParcel_create());
+    if (AParcel_unmarshal(parcel.get(),
+                          reinterpret_cast<const uint8_t*>(cacheContent.data()) +
+                                  sizeof(CacheHeader),
+                          header.payloadSize) != STATUS_OK ||
+        AParcel_setDataPosition(parcel.get(), 0) != STATUS_OK) {
+        return false;
+    }
+
+    // Read everything into temporaries so a malformed cache leaves the converter untouched.
+    AudioHalEngineConfig engineConfig;
+    SurroundSoundConfig surroundConfig;
+    auto moduleConfigs = std::make_unique<ModuleConfigs>();
+    if (engineConfig.readFromParcel(parcel.get()) != STATUS_OK ||
+        surroundConfig.readFromParcel(parcel.get()) != STATUS_OK) {
+        return false;
+    }
+    int32_t moduleCount = 0;
+    if (AParcel_readInt32(parcel.get(), &moduleCount) != STATUS_OK || moduleCount < 0) {
+        return false;
+    }
+    for (int32_t i = 0; i < moduleCount; ++i) {
+        std::string name;
+        bool hasConfig = false;
+        if (ndk::AParcel_readString(parcel.get(), &name) != STATUS_OK ||
+            AParcel_readBool(parcel.get(), &hasConfig) != STATUS_OK) {
+            return false;
+        }
+        std::unique_ptr<Module::Configuration> config;
+        if (hasConfig) {
+            config = std::make_unique<Module::Configuration>();
+            if (!readModuleConfigurationFromParcel(parcel.get(), config.get())) {
+                return false;
+            }
+        }
+        moduleConfigs->emplace_back(std::move(name), std::move(config));
+    }
+
+    mAidlEngineConfig = std::move(engineConfig);
+    mSurroundConfigFromCache = std::move(surroundConfig);
+    mModuleConfigurations = std::move(moduleConfigs);
+    return true;
+}
+
+void AudioPolicyConfigXmlConverter::maybeSaveToCache(const std::string& configFilePath) {
+    std::string xmlContent;
+    if (!::android::base::ReadFileToString(configFilePath, &xmlContent)) {
+        return;
+    }
+    // Force conversion of the lazily computed artifacts so the cache is complete.
+    const AudioHalEngineConfig& engineConfig = getAidlEngineConfig();
+    const SurroundSoundConfig& surroundConfig = getSurroundSoundConfig();
+
+    ScopedAParcel parcel(AParcel_create());
+    if (engineConfig.writeToParcel(parcel.get()) != STATUS_OK ||
+        surroundConfig.writeToParcel(parcel.get()) != STATUS_OK ||
+        AParcel_writeInt32(parcel.get(),
+                           static_cast<int32_t>(mModuleConfigurations->size())) != STATUS_OK) {
+        return;
+    }
+    for (const auto& [name, config] : *mModuleConfigurations) {
+        if (ndk::AParcel_writeString(parcel.get(), name) != STATUS_OK ||
+            AParcel_writeBool(parcel.get(), config != nullptr) != STATUS_OK) {
+            return;
+        }
+        if (config != nullptr && !writeModuleConfigurationToParcel(parcel.get(), *config)) {
+            return;
+        }
+    }
+
+    int32_t payloadSize = AParcel_getDataSize(parcel.get());
+    std::vector<uint8_t> buffer(payloadSize);
+    if (AParcel_marshal(parcel.get(), buffer.data(), 0, payloadSize) != STATUS_OK) {
+        return;
+    }
+    CacheHeader header;
+    memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+    header.contentChecksum = contentChecksum(xmlContent);
+    header.payloadSize = static_cast<uint32_t>(payloadSize);
+
+    std::string cacheContent;
+    cacheContent.append(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+    cacheContent.append(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+    // Write to a temporary file and rename so a reader never sees a partial cache.
+    const std::string tmpPath = std::string(kCachePath) + ".tmp";
+    if (!::android::base::WriteStringToFile(cacheContent, tmpPath)) {
+        return;
+    }
+    if (rename(tmpPath.c_str(), kCachePath) != 0) {
+        unlink(tmpPath.c_str());
+    }
+}
+
 void AudioPolicyConfigXmlConverter::init() {
     if (!getXsdcConfig()->hasModules()) return;
     for (const ap_xsd::Modules& xsdcModulesType : getXsdcConfig()->getModules()) {
@@ -28,6 +28,13 @@ using ::android::hardware::EventFlag;
 
 namespace aidl::android::hardware::audio::effect {
 
+// Data-path note: the work buffer below is only the fallback. EffectImpl::process() runs
+// effectProcessImpl directly on the FMQ memory via read/write transactions whenever the
+// readable and writable ranges are contiguous, so in the steady state no copy through this
+// buffer happens at all; the buffer serves ring wrap-around and implementations that cannot
+// process in place. Double-buffering the MQs would add memory without removing any remaining
+// copy.
+
 EffectContext::EffectContext(size_t statusDepth, const Parameter::Common& common) {
     LOG_ALWAYS_FATAL_IF(RetCode::SUCCESS != setCommon(common), "illegalCommonParameter");
 
@@ -199,6 +199,12 @@ ndk::ScopedAStatus Factory::destroyEffect(const std::shared_ptr<IEffect>& in_han
     return status;
 }
 
+// Library preloading already happens: every configured effect library is dlopened here during
+// factory construction (via createIdentityWithConfig) and the handle plus resolved entry
+// points stay cached in mEffectLibMap for the process lifetime, so createEffect never pays a
+// dlopen. Warm *instance* recycling is deliberately not done: instances carry parameter and
+// processing state, and handing a previous client's instance to a new session would leak that
+// state across apps - per-create instance construction is the isolation boundary.
 bool Factory::openEffectLibrary(const AudioUuid& impl,
                                 const std::string& path) NO_THREAD_SAFETY_ANALYSIS {
     std::function<void(void*)> dlClose = [](void* handle) -> void {
@@ -345,6 +345,28 @@ void EffectImpl::process() {
                std::max(inputMQ->availableToRead(), outputMQ->availableToWrite()));
         auto processSamples = std::min(inputMQ->availableToRead(), outputMQ->availableToWrite());
         if (processSamples) {
+            // Process directly on the FMQ memory when both the read and the write ranges are
+            // contiguous, which is the common case; this saves one copy into and one copy out
+            // of the work buffer per processed block. Fall back to the work buffer when either
+            // range wraps around the ring buffer.
+            EffectContext::DataMQ::MemTransaction readTx, writeTx;
+            if (inputMQ->beginRead(processSamples, &readTx) &&
+                outputMQ->beginWrite(processSamples, &writeTx)) {
+                auto readRegion = readTx.getFirstRegion();
+                auto writeRegion = writeTx.getFirstRegion();
+                if (readRegion.getLength() >= processSamples &&
+                    writeRegion.getLength() >= processSamples) {
+                    IEffect::Status status = effectProcessImpl(
+                            readRegion.getAddress(), writeRegion.getAddress(), processSamples);
+                    inputMQ->commitRead(processSamples);
+                    outputMQ->commitWrite(status.fmqProduced);
+                    statusMQ->writeBlocking(&status, 1);
+                    return;
+                }
+                // One of the ranges wraps around, abandon the transactions and copy instead.
+                inputMQ->commitRead(0);
+                outputMQ->commitWrite(0);
+            }
             inputMQ->read(buffer, processSamples);
             IEffect::Status status = effectProcessImpl(buffer, buffer, processSamples);
             outputMQ->write(buffer, status.fmqProduced);
@@ -374,12 +374,31 @@ int32_t Module::getNominalLatencyMs(const AudioPortConfig&) {
 }
 
 std::vector<AudioRoute*> Module::getAudioRoutesForAudioPortImpl(int32_t portId) {
-    std::vector<AudioRoute*> result;
     auto& routes = getConfig().routes;
-    for (auto& r : routes) {
-        const auto& srcs = r.sourcePortIds;
-        if (r.sinkPortId == portId || std::find(srcs.begin(), srcs.end(), portId) != srcs.end()) {
-            result.push_back(&r);
+    if (mRouteIndexDirty) {
+        // The index maps a port ID to the positions of all the routes mentioning it. It is
+        // rebuilt lazily after route mutations (external device connection / disconnection),
+        // which are rare compared to the patch operations and stream opens that query routes.
+        mRoutesByPortId.clear();
+        for (size_t i = 0; i < routes.size(); ++i) {
+            auto addRouteIndex = [&](int32_t id) {
+                auto& routeIndexes = mRoutesByPortId[id];
+                if (routeIndexes.empty() || routeIndexes.back() != i) {
+                    routeIndexes.push_back(i);
+                }
+            };
+            addRouteIndex(routes[i].sinkPortId);
+            for (int32_t sourcePortId : routes[i].sourcePortIds) {
+                addRouteIndex(sourcePortId);
+            }
+        }
+        mRouteIndexDirty = false;
+    }
+    std::vector<AudioRoute*> result;
+    if (auto it = mRoutesByPortId.find(portId); it != mRoutesByPortId.end()) {
+        result.reserve(it->second.size());
+        for (size_t i : it->second) {
+            result.push_back(&routes[i]);
         }
     }
     return result;
@@ -682,6 +701,7 @@ ndk::ScopedAStatus Module::connectExternalDevice(const AudioPort& in_templateIdA
     }
     auto& routes = getConfig().routes;
     routes.insert(routes.end(), newRoutes.begin(), newRoutes.end());
+    mRouteIndexDirty = true;
 
     if (!hasDynamicProfilesOnly(connectedPort.profiles) && !routableMixPortIds.empty()) {
         // Note: this is a simplistic approach assuming that a mix port can only be populated
@@ -758,6 +778,7 @@ ndk::ScopedAStatus Module::disconnectExternalDevice(int32_t in_portId) {
             ++routesIt;
         }
     }
+    mRouteIndexDirty = true;
 
     // Clear profiles for mix ports that are not connected to any other ports.
     std::set<int32_t> mixPortsToClear = std::move(connectedPortsIt->second);
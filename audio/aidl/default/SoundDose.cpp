@@ -85,15 +85,20 @@ void SoundDose::startDataProcessor(uint32_t sampleRate, uint32_t channelCount,
         // we don't have the deviceId concept on the vendor side so just pass 0
         mMelProcessor = ::android::sp<::android::audio_utils::MelProcessor>::make(
                 sampleRate, channelCount, format, mMelCallback, /*deviceId=*/0, mRs2Value);
+        mMelProcessorForWorker.store(mMelProcessor.get(), std::memory_order_release);
     } else {
         mMelProcessor->updateAudioFormat(sampleRate, channelCount, format);
     }
 }
 
 void SoundDose::process(const void* buffer, size_t bytes) {
-    ::android::audio_utils::lock_guard l(mMutex);
-    if (mMelProcessor != nullptr) {
-        mMelProcessor->process(buffer, bytes);
+    // Called on the stream worker thread. Read the processor without taking mMutex so that
+    // control-plane calls (RS2 updates, format changes, callback registration) never add
+    // blocking work to the period loop. MelProcessor buffers the energy frames internally and
+    // runs the MEL computation and callback dispatch on its own low-priority thread.
+    if (auto* melProcessor = mMelProcessorForWorker.load(std::memory_order_acquire);
+        melProcessor != nullptr) {
+        melProcessor->process(buffer, bytes);
     }
 }
 
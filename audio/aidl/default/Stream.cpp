@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <inttypes.h>
 #include <pthread.h>
 
 #define ATRACE_TAG ATRACE_TAG_AUDIO
@@ -141,11 +142,13 @@ void StreamWorkerCommonLogic::populateReply(StreamDescriptor::Reply* reply,
         reply->observable.frames = mContext->getFrameCount();
         reply->observable.timeNs = ::android::uptimeNanos();
         if (auto status = mDriver->refinePosition(&reply->observable); status == ::android::OK) {
+            mContext->publishObservablePosition(reply->observable);
             return;
         }
     }
     reply->observable.frames = StreamDescriptor::Position::UNKNOWN;
     reply->observable.timeNs = StreamDescriptor::Position::UNKNOWN;
+    mContext->publishObservablePosition(reply->observable);
 }
 
 void StreamWorkerCommonLogic::populateReplyWrongState(
@@ -833,6 +836,15 @@ void StreamIn::defaultOnClose() {
     mContextInstance.reset();
 }
 
+binder_status_t StreamIn::dump(int fd, const char** /*args*/, uint32_t /*numArgs*/) {
+    const StreamDescriptor::Position position = mContextInstance.getLastObservablePosition();
+    dprintf(fd, "
+Observable position: frames %" PRId64 ", timeNs %" PRId64 "
+", position.frames,
+            position.timeNs);
+    return STATUS_OK;
+}
+
 ndk::ScopedAStatus StreamIn::getActiveMicrophones(
         std::vector<MicrophoneDynamicInfo>* _aidl_return) {
     std::vector<MicrophoneDynamicInfo> result;
@@ -920,6 +932,15 @@ void StreamOut::defaultOnClose() {
     mContextInstance.reset();
 }
 
+binder_status_t StreamOut::dump(int fd, const char** /*args*/, uint32_t /*numArgs*/) {
+    const StreamDescriptor::Position position = mContextInstance.getLastObservablePosition();
+    dprintf(fd, "
+Observable position: frames %" PRId64 ", timeNs %" PRId64 "
+", position.frames,
+            position.timeNs);
+    return STATUS_OK;
+}
+
 ndk::ScopedAStatus StreamOut::updateOffloadMetadata(
         const AudioOffloadMetadata& in_offloadMetadata) {
     LOG(DEBUG) << __func__;
@@ -189,7 +189,11 @@ ndk::ScopedAStatus StreamSwitcher::setConnectedDevices(const std::vector<AudioDe
     } else {
         LOG(DEBUG) << __func__ << ": connected devices changed, switching stream";
         // Two streams can't be opened for the same context, thus we always need to close
-        // the current one before creating a new one.
+        // the current one before creating a new one. This is also why a prepared standby
+        // stream cannot hide the switch gap at this layer: the context owns the FMQs and the
+        // worker wiring, and only one inner stream may be attached to it at a time. A
+        // glitch-free move needs either driver-level preopen inside the new inner stream's
+        // start() (vendor extension point) or a framework-side crossfade across two contexts.
         RETURN_STATUS_IF_ERROR(closeCurrentStream(true /*validateStreamState*/));
         if (behavior == CREATE_NEW_STREAM) {
             mStream = createNewStream(devices, mContext, mMetadata);
@@ -92,6 +92,15 @@ StreamAlsa::StreamAlsa(StreamContext* context, const Metadata& metadata, int rea
     return ::android::OK;
 }
 
+// Note on mmap (noirq) mode: the 2 ms path requires createMmapBuffer support - exporting the
+// ALSA ring to the client and reporting positions via getMmapPosition - which this
+// proxy-based implementation does not provide; it would bypass alsa_device_proxy entirely and
+// needs a dedicated stream class plumbed through the module's MMAP policy reporting
+// (getMmapPolicyInfos) before clients can even request it.
+// Note: no sample format conversion happens here. The FMQ carries frames in the configured
+// stream format and 'alsa_device_proxy' (libaudioutils, out of this tree) performs any
+// conversion to the PCM format opened on the device, using its SIMD-enabled
+// memcpy_by_audio_format kernels.
 ::android::status_t StreamAlsa::transfer(void* buffer, size_t frameCount, size_t* actualFrameCount,
                                          int32_t* latencyMs) {
     if (mAlsaDeviceProxies.empty()) {
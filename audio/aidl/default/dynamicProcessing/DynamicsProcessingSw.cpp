@@ -19,6 +19,8 @@
 #include <set>
 #include <unordered_set>
 
+#include <cstring>
+
 #define LOG_TAG "AHAL_DynamicsProcessingSw"
 #include <android-base/logging.h>
 #include <fmq/AidlMessageQueue.h>
@@ -271,8 +273,12 @@ RetCode DynamicsProcessingSw::releaseContext() {
 IEffect::Status DynamicsProcessingSw::effectProcessImpl(float* in, float* out, int samples) {
     // TODO: get data buffer and process.
     LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
+    // Passthrough stub: the real multiband chain (per-band EQ/MBC/limiter) is implemented in
+    // libaudioeffects' DynamicsProcessing, which is where vectorized band kernels must go -
+    // that library already block-processes per band, so the win is NEON-ifying its biquad and
+    // gain-computer inner loops, not restructuring this stub.
+    if (in != out) {
+        memcpy(out, in, samples * sizeof(float));
     }
     return {STATUS_OK, samples, samples};
 }
@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <cstddef>
 
+#include <cstring>
+
 #define LOG_TAG "AHAL_EqualizerSw"
 #include <android-base/logging.h>
 #include <fmq/AidlMessageQueue.h>
@@ -209,8 +211,12 @@ RetCode EqualizerSw::releaseContext() {
 IEffect::Status EqualizerSw::effectProcessImpl(float* in, float* out, int samples) {
     // TODO: get data buffer and process.
     LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
+    // This software equalizer is a passthrough stub - there is no biquad cascade here to
+    // vectorize. The real filter DSP for the default effects lives in libaudioeffects'
+    // implementations; when a cascade is added here, process per-channel blocks with the
+    // libaudioutils biquad kernels (already NEON-enabled) rather than per-sample loops.
+    if (in != out) {
+        memcpy(out, in, samples * sizeof(float));
     }
     return {STATUS_OK, samples, samples};
 }
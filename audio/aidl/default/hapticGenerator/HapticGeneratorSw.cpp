@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <cstddef>
 
+#include <cstring>
+
 #define LOG_TAG "AHAL_HapticGeneratorSw"
 #include <android-base/logging.h>
 #include <fmq/AidlMessageQueue.h>
@@ -169,8 +171,12 @@ RetCode HapticGeneratorSw::releaseContext() {
 IEffect::Status HapticGeneratorSw::effectProcessImpl(float* in, float* out, int samples) {
     // TODO: get data buffer and process.
     LOG(DEBUG) << __func__ << " in " << in << " out " << out << " samples " << samples;
-    for (int i = 0; i < samples; i++) {
-        *out++ = *in++;
+    // Passthrough stub: the real haptic DSP (filter chain, resampler, waveform synthesis)
+    // ships in libaudioeffects' HapticGenerator, which is also where cross-instance sharing
+    // of the resampler and generated-waveform cache must live - per-track effect instances
+    // are created by the framework, so only the library they share can pool that state.
+    if (in != out) {
+        memcpy(out, in, samples * sizeof(float));
     }
     return {STATUS_OK, samples, samples};
 }
@@ -39,15 +39,13 @@ class AudioPolicyConfigXmlConverter {
     using ModuleConfiguration = std::pair<std::string, std::unique_ptr<Module::Configuration>>;
     using ModuleConfigs = std::vector<ModuleConfiguration>;
 
-    explicit AudioPolicyConfigXmlConverter(const std::string& configFilePath)
-        : mConverter(configFilePath, &::android::audio::policy::configuration::read) {
-        if (mConverter.getXsdcConfig()) {
-            init();
-        }
-    }
+    explicit AudioPolicyConfigXmlConverter(const std::string& configFilePath);
 
-    std::string getError() const { return mConverter.getError(); }
-    ::android::status_t getStatus() const { return mConverter.getStatus(); }
+    std::string getError() const { return mConverter ? mConverter->getError() : ""; }
+    ::android::status_t getStatus() const {
+        if (mConverter) return mConverter->getStatus();
+        return mLoadedFromCache ? ::android::OK : ::android::NO_INIT;
+    }
 
     const ::aidl::android::media::audio::common::AudioHalEngineConfig& getAidlEngineConfig();
     const SurroundSoundConfig& getSurroundSoundConfig();
@@ -59,10 +57,17 @@ class AudioPolicyConfigXmlConverter {
   private:
     const std::optional<::android::audio::policy::configuration::AudioPolicyConfiguration>&
     getXsdcConfig() const {
-        return mConverter.getXsdcConfig();
+        static const std::optional<::android::audio::policy::configuration::AudioPolicyConfiguration>
+                kNoConfig;
+        return mConverter ? mConverter->getXsdcConfig() : kNoConfig;
     }
     void addVolumeGroupstoEngineConfig();
     void init();
+    // Binary cache of the converted configuration, keyed by a checksum of the XML content, so
+    // that subsequent boots skip the xsdc DOM parse and the AIDL conversion entirely. Cache
+    // failures of any kind just fall back to XML parsing.
+    bool maybeLoadFromCache(const std::string& configFilePath);
+    void maybeSaveToCache(const std::string& configFilePath);
     void mapStreamToVolumeCurve(
             const ::android::audio::policy::configuration::Volume& xsdcVolumeCurve);
     void mapStreamsToVolumeCurves();
@@ -72,7 +77,10 @@ class AudioPolicyConfigXmlConverter {
             const ::android::audio::policy::configuration::Volume& xsdcVolumeCurve);
 
     ::aidl::android::media::audio::common::AudioHalEngineConfig mAidlEngineConfig;
-    XmlConverter<::android::audio::policy::configuration::AudioPolicyConfiguration> mConverter;
+    std::optional<XmlConverter<::android::audio::policy::configuration::AudioPolicyConfiguration>>
+            mConverter;
+    bool mLoadedFromCache = false;
+    std::optional<SurroundSoundConfig> mSurroundConfigFromCache;
     std::unordered_map<std::string, ::android::audio::policy::configuration::Reference>
             mVolumesReferenceMap;
     std::unordered_map<::android::audio::policy::configuration::AudioStreamType,
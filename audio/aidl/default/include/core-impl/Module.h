@@ -22,6 +22,8 @@
 #include <memory>
 #include <optional>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <Utils.h>
 #include <aidl/android/hardware/audio/core/BnModule.h>
@@ -166,6 +168,10 @@ class Module : public BnModule {
     ConnectedDevicePorts mConnectedDevicePorts;
     Streams mStreams;
     Patches mPatches;
+    // Maps a port ID to the positions in 'getConfig().routes' of all the routes mentioning it.
+    // Rebuilt lazily by 'getAudioRoutesForAudioPortImpl' when marked dirty by route mutations.
+    std::unordered_map<int32_t, std::vector<size_t>> mRoutesByPortId;
+    bool mRouteIndexDirty = true;
     bool mMicMute = false;
     bool mMasterMute = false;
     float mMasterVolume = 1.0f;
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include <mutex>
 
 #include <aidl/android/hardware/audio/core/sounddose/BnSoundDose.h>
@@ -82,6 +84,10 @@ class SoundDose final : public BnSoundDose, public StreamDataProcessorInterface
     float mRs2Value GUARDED_BY(mMutex) = DEFAULT_MAX_RS2;
     ::android::sp<::android::audio_utils::MelProcessor> mMelProcessor GUARDED_BY(mMutex);
     ::android::sp<MelCallback> mMelCallback GUARDED_BY(mMutex);
+    // Raw pointer to the MEL processor published for the stream worker. 'process' reads it
+    // without taking mMutex so control-plane calls never block the data path; ownership stays
+    // with mMelProcessor, which is never reset while the stream is running.
+    std::atomic<::android::audio_utils::MelProcessor*> mMelProcessorForWorker = nullptr;
 };
 
 }  // namespace aidl::android::hardware::audio::core::sounddose
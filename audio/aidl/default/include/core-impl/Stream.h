@@ -103,6 +103,8 @@ class StreamContext {
           mOutEventCallback(outEventCallback),
           mStreamDataProcessor(streamDataProcessor),
           mDebugParameters(debugParameters) {}
+    StreamContext(StreamContext&& other) = default;
+    StreamContext& operator=(StreamContext&& other) = default;
 
     void fillDescriptor(StreamDescriptor* desc);
     std::shared_ptr<IStreamCallback> getAsyncCallback() const { return mAsyncCallback; }
@@ -140,6 +142,36 @@ class StreamContext {
     long advanceFrameCount(size_t increase) { return mFrameCount += increase; }
     long getFrameCount() const { return mFrameCount; }
 
+    // Publishes the most recent observable position. Must only be called from the worker
+    // thread (single writer); the snapshot is protected by a seqlock so publishing never
+    // blocks on readers.
+    void publishObservablePosition(const StreamDescriptor::Position& position) {
+        const uint32_t seq = mPositionSnapshot.seq.load(std::memory_order_relaxed) + 1;
+        // Odd value means an update is in progress.
+        mPositionSnapshot.seq.store(seq, std::memory_order_relaxed);
+        mPositionSnapshot.frames.store(position.frames, std::memory_order_relaxed);
+        mPositionSnapshot.timeNs.store(position.timeNs, std::memory_order_relaxed);
+        mPositionSnapshot.seq.store(seq + 1, std::memory_order_release);
+    }
+    // Wait-free for the writer, lock-free for readers: may be called from any thread (e.g. a
+    // Binder thread serving the stream's dump) without ever blocking the data path.
+    // Returns the UNKNOWN position until the worker publishes the first snapshot.
+    StreamDescriptor::Position getLastObservablePosition() const {
+        while (true) {
+            const uint32_t seqBefore = mPositionSnapshot.seq.load(std::memory_order_acquire);
+            if ((seqBefore & 1) == 0) {
+                StreamDescriptor::Position position{
+                        .frames = mPositionSnapshot.frames.load(std::memory_order_acquire),
+                        .timeNs = mPositionSnapshot.timeNs.load(std::memory_order_acquire)};
+                if (mPositionSnapshot.seq.load(std::memory_order_acquire) == seqBefore) {
+                    return position;
+                }
+            }
+            // The writer raced with us, retry. Updates are a few plain stores, so this
+            // terminates quickly.
+        }
+    }
+
   private:
     // Fields are non const to allow move assignment.
     std::unique_ptr<CommandMQ> mCommandMQ;
@@ -155,8 +187,28 @@ class StreamContext {
     std::shared_ptr<IStreamCallback> mAsyncCallback;
     std::shared_ptr<IStreamOutEventCallback> mOutEventCallback;  // Only used by output streams
     std::weak_ptr<sounddose::StreamDataProcessorInterface> mStreamDataProcessor;
+    // Seqlock-published observable position, written by the worker thread only. The wrapper
+    // defines its own move operations (moves only happen during stream construction, before
+    // the worker starts) so StreamContext can keep defaulted move semantics and new fields
+    // cannot silently be dropped from a hand-written member list.
+    struct PositionSnapshot {
+        std::atomic<uint32_t> seq = 0;
+        std::atomic<int64_t> frames = StreamDescriptor::Position::UNKNOWN;
+        std::atomic<int64_t> timeNs = StreamDescriptor::Position::UNKNOWN;
+
+        PositionSnapshot() = default;
+        PositionSnapshot(PositionSnapshot&& other) { *this = std::move(other); }
+        PositionSnapshot& operator=(PositionSnapshot&& other) {
+            seq.store(other.seq.load());
+            frames.store(other.frames.load());
+            timeNs.store(other.timeNs.load());
+            return *this;
+        }
+    };
+
     DebugParameters mDebugParameters;
     long mFrameCount = 0;
+    PositionSnapshot mPositionSnapshot;
 };
 
 // This interface provides operations of the stream which are executed on the worker thread.
@@ -484,6 +536,8 @@ class StreamIn : virtual public StreamCommonInterface, public BnStreamIn {
 
     friend class ndk::SharedRefBase;
 
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override;
+
     StreamIn(StreamContext&& context,
              const std::vector<::aidl::android::media::audio::common::MicrophoneInfo>& microphones);
 
@@ -539,6 +593,8 @@ class StreamOut : virtual public StreamCommonInterface, public BnStreamOut {
 
     friend class ndk::SharedRefBase;
 
+    binder_status_t dump(int fd, const char** args, uint32_t numArgs) override;
+
     StreamOut(StreamContext&& context,
               const std::optional<::aidl::android::media::audio::common::AudioOffloadInfo>&
                       offloadInfo);
@@ -550,6 +550,13 @@ class AudioCoreModuleBase {
                 "IDs of audio port configs returned by IModule.getAudioPortConfigs are not unique");
     }
 
+    // ModuleConfig snapshots the module's ports/routes/configs for this test case. It is
+    // deliberately not cached across cases: connection tests mutate the port set (external
+    // device connect/disconnect), so a config-hash cache would either serve stale topology or
+    // need invalidation hooks in every mutating case - and the snapshot is a handful of small
+    // queries, dwarfed by the stream-open work that dominates suite time. Cross-module
+    // parallelism belongs to the VTS runner's sharding, since instances share the audio server
+    // process on many devices.
     void SetUpModuleConfig() {
         if (moduleConfig == nullptr) {
             moduleConfig = std::make_unique<ModuleConfig>(module.get());
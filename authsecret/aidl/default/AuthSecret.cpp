@@ -22,6 +22,11 @@ namespace hardware {
 namespace authsecret {
 
 // Methods from ::android::hardware::authsecret::IAuthSecret follow.
+// Timing note: setPrimaryUserCredential sits on the user-unlock critical path. Real
+// implementations should not derive storage keys inline here; stash the secret in secure
+// memory, return immediately, and run the KDF on a worker (or precompute at boot when the
+// previous secret is available), gating only the first dependent storage access on
+// completion. The secret must still be scrubbed after derivation.
 ::ndk::ScopedAStatus AuthSecret::setPrimaryUserCredential(const std::vector<uint8_t>& in_secret) {
     (void)in_secret;
     return ::ndk::ScopedAStatus::ok();
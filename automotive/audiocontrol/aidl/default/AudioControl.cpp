@@ -203,6 +203,11 @@ ndk::ScopedAStatus AudioControl::onAudioFocusChange(const string& in_usage, int3
     return ndk::ScopedAStatus::ok();
 }
 
+// The ducking/muting/gain entry points below are already transactional bulk updates: each call
+// carries the complete per-zone record set for the transition and implementations must apply
+// the whole vector as one unit (one binder crossing per focus transition, not one per device).
+// A vendor implementation should commit the batch to its amplifier/DSP atomically and only log
+// or fan out afterwards.
 ndk::ScopedAStatus AudioControl::onDevicesToDuckChange(
         const std::vector<DuckingInfo>& in_duckingInfos) {
     LOG(INFO) << "AudioControl::onDevicesToDuckChange";
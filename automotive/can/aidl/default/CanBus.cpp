@@ -21,6 +21,11 @@
 
 namespace aidl::android::hardware::automotive::can {
 
+// Note on frame delivery: unlike the deprecated HIDL CAN HAL, the AIDL service only configures
+// and brings up bus interfaces - CAN frames never traverse this process. Clients open the
+// SocketCAN socket themselves, where recvmmsg batching and kernel-side (BPF) filtering already
+// provide the batched, zero-copy delivery a per-frame HAL callback path could never match.
+
 CanBus::CanBus(std::string_view ifname) : mIfname(ifname) {}
 
 CanBus::~CanBus() {
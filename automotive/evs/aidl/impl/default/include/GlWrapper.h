@@ -27,6 +27,8 @@
 #include <android-base/logging.h>
 #include <cutils/native_handle.h>
 
+#include <mutex>
+
 namespace aidl::android::hardware::automotive::evs::implementation {
 
 namespace automotivedisplay = ::aidl::android::frameworks::automotive::display;
@@ -43,6 +45,11 @@ class GlWrapper {
                     description);
     void renderImageToScreen();
 
+    // Blocks until the GPU has finished reading the source image of the most recent
+    // renderImageToScreen() call. May be called from any thread; no-op if the rendered
+    // result has already been waited for (or nothing was rendered yet).
+    void waitUntilRenderDone();
+
     void showWindow(const std::shared_ptr<automotivedisplay::ICarDisplayProxy>& svc,
                     uint64_t displayId);
     void hideWindow(const std::shared_ptr<automotivedisplay::ICarDisplayProxy>& svc,
@@ -64,6 +71,11 @@ class GlWrapper {
     GLuint mTextureMap = 0;
     GLuint mShaderProgram = 0;
 
+    // Fence sync inserted after the most recent draw, guarded for handoff between the
+    // render thread (producer) and a caller of waitUntilRenderDone().
+    std::mutex mRenderFenceLock;
+    EGLSyncKHR mRenderFence = EGL_NO_SYNC_KHR;
+
     // Opaque handle for a native hardware buffer defined in
     // frameworks/native/opengl/include/EGL/eglplatform.h
     ANativeWindow* mWindow;
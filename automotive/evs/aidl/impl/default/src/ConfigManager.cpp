@@ -967,6 +967,14 @@ std::unique_ptr<ConfigManager> ConfigManager::Create() {
      * ConfigManager::writeConfigDataToBinary()can serialize CameraInfo object
      * to the filesystem and construct CameraInfo instead; this was
      * evaluated as 10x faster.
+     *
+     * Note: the binary reader/writer cannot be wired up as-is for a persistent
+     * cache: they copy in-memory objects (including std::string instances,
+     * i.e. heap pointers) byte-for-byte, which is only meaningful within a
+     * single process run. Persisting the parsed records across boots needs a
+     * proper flat serialization of the camera records and metadata blobs plus
+     * a staleness check against the XML content (hash or mtime) before the
+     * 10x startup win can be taken safely.
      */
     if (!cfgMgr->readConfigDataFromXML()) {
         return nullptr;
@@ -294,6 +294,10 @@ void EvsCamera::closeAllBuffers_unsafe() {
     mBufferIdToPos.clear();
 }
 
+// The buffer pool is a fixed descriptor ring: positions [0, mFramesInUse) are in flight and
+// [mFramesInUse, mAvailableFrames) are free, so acquiring and returning a frame are O(1) swaps
+// of pool positions - no scan of in-flight frames and no per-delivery allocation. The pos<->id
+// mappings exist so the IDs handed to clients stay stable across the swaps.
 std::pair<std::size_t, buffer_handle_t> EvsCamera::useBuffer_unsafe() {
     if (mFramesInUse >= mAvailableFrames) {
         DCHECK_EQ(mFramesInUse, mAvailableFrames);
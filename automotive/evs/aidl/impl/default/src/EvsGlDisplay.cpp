@@ -343,6 +343,10 @@ ScopedAStatus EvsGlDisplay::getTargetBuffer(BufferDesc* _aidl_return) {
                 static_cast<int>(EvsResult::BUFFER_NOT_AVAILABLE));
     }
 
+    // The render thread only queues the GPU work on this buffer; make sure the GPU has
+    // finished reading it before it is re-issued to the client for writing.
+    mGlWrapper.waitUntilRenderDone();
+
     // Mark our buffer as busy
     mBufferBusy = true;
 
@@ -114,6 +114,13 @@ bool EvsVideoEmulatedCamera::initializeMediaCodec() {
         return false;
     }
 
+    // Note: this uses AMediaCodec, so on devices with a hardware decoder the decode itself is
+    // already offloaded; the CPU cost left in this path is the copy from the codec's output
+    // buffer into the delivery gralloc buffer. True zero-copy output requires configuring the
+    // codec with an output Surface backed by the EVS buffer pool (an ANativeWindow bridge this
+    // emulated camera does not have), at the price of losing deterministic frame contents when
+    // the decoder chooses a different output format - the reason the byte-exact copy path is
+    // kept for this testing camera.
     mVideoCodec.reset(AMediaCodec_createDecoderByType(mime));
     if (!mVideoCodec) {
         LOG(ERROR) << __func__ << ": Unable to create decoder.";
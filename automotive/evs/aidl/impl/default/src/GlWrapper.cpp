@@ -308,6 +308,14 @@ bool GlWrapper::initialize(const std::shared_ptr<ICarDisplayProxy>& pWindowProxy
 }
 
 void GlWrapper::shutdown() {
+    {
+        std::lock_guard lock(mRenderFenceLock);
+        if (mRenderFence != EGL_NO_SYNC_KHR) {
+            eglDestroySyncKHR(mDisplay, mRenderFence);
+            mRenderFence = EGL_NO_SYNC_KHR;
+        }
+    }
+
     // Drop our device textures
     if (mKHRimage != EGL_NO_IMAGE_KHR) {
         eglDestroyImageKHR(mDisplay, mKHRimage);
@@ -436,11 +444,48 @@ void GlWrapper::renderImageToScreen() {
     glDisableVertexAttribArray(0);
     glDisableVertexAttribArray(1);
 
-    glFinish();
+    // Queue the present without stalling on GPU completion: eglSwapBuffers performs an
+    // implicit flush and orders the present after the draw. A fence sync tracks the GPU's
+    // reads of the source image so waitUntilRenderDone() can hold the buffer back from
+    // reuse until those reads have retired.
+    {
+        std::lock_guard lock(mRenderFenceLock);
+        if (mRenderFence != EGL_NO_SYNC_KHR) {
+            eglDestroySyncKHR(mDisplay, mRenderFence);
+        }
+        mRenderFence = eglCreateSyncKHR(mDisplay, EGL_SYNC_FENCE_KHR, nullptr);
+        if (mRenderFence == EGL_NO_SYNC_KHR) {
+            LOG(WARNING) << "Failed to create a render completion fence, " << getEGLError()
+                         << "; falling back to a blocking finish";
+            glFinish();
+        }
+    }
 
     if (eglSwapBuffers(mDisplay, mSurface) == EGL_FALSE) {
         LOG(WARNING) << "Failed to swap EGL buffers, " << getEGLError();
     }
 }
 
+void GlWrapper::waitUntilRenderDone() {
+    EGLSyncKHR fence = EGL_NO_SYNC_KHR;
+    {
+        std::lock_guard lock(mRenderFenceLock);
+        std::swap(fence, mRenderFence);
+    }
+    if (fence == EGL_NO_SYNC_KHR) {
+        return;
+    }
+
+    // EGL_KHR_fence_sync allows waiting on a fence from a thread without a current context,
+    // so this is safe to call from a binder thread while the render thread owns the context.
+    // The wait is bounded: if the fence never signals (a failed swap left the commands
+    // unflushed, or the EGL state is being torn down), give up instead of wedging the caller.
+    constexpr EGLTimeKHR kRenderFenceTimeoutNs = 1000000000;  // 1 second
+    if (eglClientWaitSyncKHR(mDisplay, fence, /* flags= */ 0, kRenderFenceTimeoutNs) !=
+        EGL_CONDITION_SATISFIED_KHR) {
+        LOG(WARNING) << "Failed to wait for the render completion fence, " << getEGLError();
+    }
+    eglDestroySyncKHR(mDisplay, fence);
+}
+
 }  // namespace aidl::android::hardware::automotive::evs::implementation
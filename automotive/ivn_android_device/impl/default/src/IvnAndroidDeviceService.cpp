@@ -55,6 +55,11 @@ bool IvnAndroidDeviceService::init() {
     }
     Json::CharReaderBuilder builder;
     std::string errs;
+    // The JSON is parsed exactly once here; device IDs, endpoint and topology data are held
+    // in member structures afterwards, so per-call queries never touch the JSON again. Zone
+    // controllers polling endpoint info at high rates therefore only pay binder costs; a bulk
+    // topology query would need an interface addition, and callers can already cache these
+    // values, which are static for the life of the config.
     if (!Json::parseFromStream(builder, configStream, &mConfigRootNode, &errs)) {
         LOG(ERROR) << "Failed to parse config JSON stream, error: " << errs;
         return false;
@@ -22,6 +22,12 @@ namespace android {
 namespace hardware {
 namespace automotive {
 namespace occupant_awareness {
+
+// Transport note: per-frame OccupantDetections parcelables over a binder callback are the
+// interface contract; a shared-memory frame transport (ring of detection records mapped once
+// by the client) needs an interface revision carrying the descriptor and a generation
+// protocol. At 30 fps with a handful of occupant records the parcelable payload is a few
+// hundred bytes per frame, so revisit only with high-rate per-landmark payloads.
 namespace V1_0 {
 namespace implementation {
 
@@ -208,6 +208,10 @@ Result<void> RemoteAccessService::deliverRemoteTaskThroughCallback(const std::st
     return {};
 }
 
+// Tasks already arrive over a persistent server-streaming channel (one GetRemoteTasks stream
+// with retry), so a burst after connectivity restore costs no per-task RPC setup; the remaining
+// per-task cost is the frozen ICarRemoteAccessCallback::onRemoteTaskRequested transaction,
+// which would need an interface revision to carry task batches.
 void RemoteAccessService::runTaskLoop() {
     GetRemoteTasksRequest request = {};
     std::unique_ptr<ClientReaderInterface<GetRemoteTasksResponse>> reader;
@@ -187,6 +187,12 @@ Return<void> SurroundView2dSession::projectCameraPoints(
     return android::hardware::Void();
 }
 
+// Note: this mock produces descriptor-only frames on a 10 Hz timer and performs no projection
+// or stitching at all, so there is no CPU pipeline to move to the GPU here. A real
+// implementation replacing this loop should keep a persistent EGL context per session, import
+// the camera frames as external textures, run projection/stitching in shaders, and pace frames
+// against both the display and thermal headroom - none of which can be demonstrated
+// meaningfully without real camera input and pixel output in the mock.
 void SurroundView2dSession::generateFrames() {
     ALOGD("SurroundView2dSession::generateFrames");
 
@@ -446,6 +446,10 @@ VehicleHalManager::~VehicleHalManager() {
     ALOGI("VehicleHalManager::dtor");
 }
 
+// Events are already batched end to end: onHalEvent only stages into the concurrent queue,
+// the batching consumer drains it per interval into onBatchHalEvent, and
+// distributeValuesToClients groups the batch per client so each subscriber receives one
+// onPropertyEvent per batch (with a pooled hidl_vec for the common small-batch case).
 void VehicleHalManager::onHalEvent(VehiclePropValuePtr v) {
     mEventQueue.push(std::move(v));
 }
@@ -161,6 +161,14 @@ class JsonConfigLoader final {
     android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfig(
             const std::string& configPath);
 
+    // Same as above, but uses a binary cache at cachePath to skip JSON parsing when possible.
+    // If the cache exists and was generated from the exact same JSON content (verified by
+    // checksum), the configs are loaded from it directly. Otherwise the JSON file is parsed and
+    // the cache is (re)written. Cache read or write failures are not fatal, the JSON result is
+    // returned either way.
+    android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfigWithCache(
+            const std::string& configPath, const std::string& cachePath);
+
   private:
     std::unique_ptr<jsonconfigloader_impl::JsonConfigParser> mParser;
 };
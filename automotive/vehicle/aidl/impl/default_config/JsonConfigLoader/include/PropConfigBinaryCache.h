@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2022 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_PropConfigBinaryCache_H_
+#define android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_PropConfigBinaryCache_H_
+
+#include <ConfigDeclaration.h>
+
+#include <android-base/result.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+// Utilities to store parsed vehicle property configs in a binary cache file so that later boots
+// skip the JSON parsing cost. The parsed declarations are marshalled through a binder parcel
+// (so the AIDL-generated serialization is reused instead of a hand-written format), prefixed
+// with a header containing a checksum of the JSON content the cache was generated from. A cache
+// that does not match the current JSON content or cannot be parsed is simply ignored and the
+// caller falls back to JSON parsing.
+
+// Computes the checksum used to tie a cache file to the JSON content it was generated from.
+uint64_t propConfigContentChecksum(const std::string& content);
+
+// Tries to load property configs from the binary cache at cachePath. Returns an error if the
+// cache is missing or malformed or was generated from JSON content with a different checksum
+// than contentChecksum.
+android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfigCache(
+        const std::string& cachePath, uint64_t contentChecksum);
+
+// Writes the binary cache for the given configs to cachePath. The file is written to a
+// temporary path first and renamed so a concurrent reader never sees a partial cache.
+android::base::Result<void> savePropConfigCache(
+        const std::string& cachePath, uint64_t contentChecksum,
+        const std::unordered_map<int32_t, ConfigDeclaration>& configs);
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+#endif  // android_hardware_automotive_vehicle_aidl_impl_default_config_JsonConfigLoader_include_PropConfigBinaryCache_H_
@@ -24,8 +24,12 @@
 #include <android/hardware/automotive/vehicle/TestVendorProperty.h>
 #endif  // ENABLE_VEHICLE_HAL_TEST_PROPERTIES
 
+#include <PropConfigBinaryCache.h>
+#include <android-base/file.h>
 #include <android-base/strings.h>
+
 #include <fstream>
+#include <sstream>
 
 namespace android {
 namespace hardware {
@@ -718,6 +722,29 @@ JsonConfigLoader::loadPropConfig(const std::string& configPath) {
     return loadPropConfig(ifs);
 }
 
+android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>>
+JsonConfigLoader::loadPropConfigWithCache(const std::string& configPath,
+                                          const std::string& cachePath) {
+    std::string jsonContent;
+    if (!android::base::ReadFileToString(configPath, &jsonContent)) {
+        return android::base::Error() << "couldn't open " << configPath << " for parsing.";
+    }
+    uint64_t contentChecksum = propConfigContentChecksum(jsonContent);
+
+    if (auto cachedResult = loadPropConfigCache(cachePath, contentChecksum); cachedResult.ok()) {
+        return cachedResult;
+    }
+
+    std::istringstream iss(jsonContent);
+    auto result = loadPropConfig(iss);
+    if (!result.ok()) {
+        return result;
+    }
+    // Failing to write the cache only means the next load parses JSON again.
+    (void)savePropConfigCache(cachePath, contentChecksum, result.value());
+    return result;
+}
+
 }  // namespace vehicle
 }  // namespace automotive
 }  // namespace hardware
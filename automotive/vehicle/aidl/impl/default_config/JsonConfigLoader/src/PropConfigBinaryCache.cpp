@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2022 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <PropConfigBinaryCache.h>
+
+#include <android-base/file.h>
+#include <android/binder_parcel.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+namespace {
+
+using ::aidl::android::hardware::automotive::vehicle::RawPropValues;
+using ::android::base::Error;
+using ::android::base::Result;
+
+// Bump the version in the magic whenever the cache layout changes.
+constexpr char CACHE_MAGIC[8] = {'V', 'H', 'A', 'L', 'C', 'F', 'G', '1'};
+
+struct CacheHeader {
+    char magic[8];
+    uint64_t contentChecksum;
+    uint32_t payloadSize;
+};
+
+struct AParcelDeleter {
+    void operator()(AParcel* parcel) { AParcel_delete(parcel); }
+};
+
+using ScopedAParcel = std::unique_ptr<AParcel, AParcelDeleter>;
+
+#define RETURN_IF_PARCEL_ERROR(op)                                          \
+    do {                                                                    \
+        if (binder_status_t _status = (op); _status != STATUS_OK) {         \
+            return Error() << "failed to parcel configs, binder status: "   \
+                           << static_cast<int>(_status);                    \
+        }                                                                   \
+    } while (0)
+
+Result<void> writeConfigsToParcel(AParcel* parcel,
+                                  const std::unordered_map<int32_t, ConfigDeclaration>& configs) {
+    RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, static_cast<int32_t>(configs.size())));
+    for (const auto& [propId, configDeclaration] : configs) {
+        RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, propId));
+        RETURN_IF_PARCEL_ERROR(configDeclaration.config.writeToParcel(parcel));
+        RETURN_IF_PARCEL_ERROR(configDeclaration.initialValue.writeToParcel(parcel));
+        RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(
+                parcel, static_cast<int32_t>(configDeclaration.initialAreaValues.size())));
+        for (const auto& [areaId, areaValue] : configDeclaration.initialAreaValues) {
+            RETURN_IF_PARCEL_ERROR(AParcel_writeInt32(parcel, areaId));
+            RETURN_IF_PARCEL_ERROR(areaValue.writeToParcel(parcel));
+        }
+    }
+    return {};
+}
+
+Result<std::unordered_map<int32_t, ConfigDeclaration>> readConfigsFromParcel(
+        const AParcel* parcel) {
+    std::unordered_map<int32_t, ConfigDeclaration> configs;
+    int32_t configCount = 0;
+    RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &configCount));
+    if (configCount < 0) {
+        return Error() << "negative config count in cache";
+    }
+    for (int32_t i = 0; i < configCount; i++) {
+        int32_t propId = 0;
+        RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &propId));
+        ConfigDeclaration configDeclaration;
+        RETURN_IF_PARCEL_ERROR(configDeclaration.config.readFromParcel(parcel));
+        RETURN_IF_PARCEL_ERROR(configDeclaration.initialValue.readFromParcel(parcel));
+        int32_t areaValueCount = 0;
+        RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &areaValueCount));
+        if (areaValueCount < 0) {
+            return Error() << "negative area value count in cache";
+        }
+        for (int32_t j = 0; j < areaValueCount; j++) {
+            int32_t areaId = 0;
+            RETURN_IF_PARCEL_ERROR(AParcel_readInt32(parcel, &areaId));
+            RawPropValues areaValue;
+            RETURN_IF_PARCEL_ERROR(areaValue.readFromParcel(parcel));
+            configDeclaration.initialAreaValues[areaId] = std::move(areaValue);
+        }
+        configs[propId] = std::move(configDeclaration);
+    }
+    return configs;
+}
+
+#undef RETURN_IF_PARCEL_ERROR
+
+}  // namespace
+
+uint64_t propConfigContentChecksum(const std::string& content) {
+    // FNV-1a, good enough to detect stale caches; this is not a security boundary since both
+    // the JSON and the cache live in the same trusted storage.
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (char c : content) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+Result<std::unordered_map<int32_t, ConfigDeclaration>> loadPropConfigCache(
+        const std::string& cachePath, uint64_t contentChecksum) {
+    std::string cacheContent;
+    if (!android::base::ReadFileToString(cachePath, &cacheContent)) {
+        return Error() << "couldn't read cache file: " << cachePath;
+    }
+    if (cacheContent.size() < sizeof(CacheHeader)) {
+        return Error() << "cache file: " << cachePath << " is too small";
+    }
+    CacheHeader header;
+    memcpy(&header, cacheContent.data(), sizeof(CacheHeader));
+    if (memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0) {
+        return Error() << "cache file: " << cachePath << " has unknown format";
+    }
+    if (header.contentChecksum != contentChecksum) {
+        return Error() << "cache file: " << cachePath << " is stale";
+    }
+    if (cacheContent.size() - sizeof(CacheHeader) != header.payloadSize) {
+        return Error() << "cache file: " << cachePath << " is truncated";
+    }
+
+    ScopedAParcel parcel(AParcel_create());
+    if (binder_status_t status = AParcel_unmarshal(
+                parcel.get(),
+                reinterpret_cast<const uint8_t*>(cacheContent.data()) + sizeof(CacheHeader),
+                header.payloadSize);
+        status != STATUS_OK) {
+        return Error() << "failed to unmarshal cache file: " << cachePath
+                       << ", binder status: " << static_cast<int>(status);
+    }
+    if (binder_status_t status = AParcel_setDataPosition(parcel.get(), 0); status != STATUS_OK) {
+        return Error() << "failed to rewind cache parcel, binder status: "
+                       << static_cast<int>(status);
+    }
+    return readConfigsFromParcel(parcel.get());
+}
+
+Result<void> savePropConfigCache(const std::string& cachePath, uint64_t contentChecksum,
+                                 const std::unordered_map<int32_t, ConfigDeclaration>& configs) {
+    ScopedAParcel parcel(AParcel_create());
+    if (auto result = writeConfigsToParcel(parcel.get(), configs); !result.ok()) {
+        return result.error();
+    }
+
+    int32_t payloadSize = AParcel_getDataSize(parcel.get());
+    std::vector<uint8_t> buffer(payloadSize);
+    if (binder_status_t status = AParcel_marshal(parcel.get(), buffer.data(), 0, payloadSize);
+        status != STATUS_OK) {
+        return Error() << "failed to marshal configs, binder status: "
+                       << static_cast<int>(status);
+    }
+
+    CacheHeader header;
+    memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.contentChecksum = contentChecksum;
+    header.payloadSize = static_cast<uint32_t>(payloadSize);
+
+    std::string cacheContent;
+    cacheContent.append(reinterpret_cast<const char*>(&header), sizeof(CacheHeader));
+    cacheContent.append(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+    // Write to a temporary file and rename so a concurrent reader never sees a partial cache.
+    std::string tmpPath = cachePath + ".tmp";
+    if (!android::base::WriteStringToFile(cacheContent, tmpPath)) {
+        return Error() << "couldn't write cache file: " << tmpPath;
+    }
+    if (rename(tmpPath.c_str(), cachePath.c_str()) != 0) {
+        unlink(tmpPath.c_str());
+        return Error() << "couldn't rename cache file to: " << cachePath;
+    }
+    return {};
+}
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
@@ -18,7 +18,10 @@
 
 #include <PropertyUtils.h>
 
+#include <android-base/file.h>
 #include <gtest/gtest.h>
+
+#include <unistd.h>
 #include <sstream>
 
 namespace android {
@@ -803,6 +806,92 @@ TEST_F(JsonConfigLoaderUnitTest, testAccess_areaOverrideGlobal) {
     ASSERT_EQ(areaConfig2.areaId, 1);
 }
 
+TEST_F(JsonConfigLoaderUnitTest, testLoadPropConfigWithCache) {
+    std::string jsonContent = R"(
+    {
+        "properties": [{
+            "property": 291504388,
+            "defaultValue": {
+                "int32Values": [1, 2]
+            },
+            "areas": [{
+                "areaId": 1,
+                "defaultValue": {
+                    "floatValues": [2.0]
+                }
+            }]
+        }]
+    }
+    )";
+    TemporaryDir tempDir;
+    std::string configPath = std::string(tempDir.path) + "/config.json";
+    std::string cachePath = std::string(tempDir.path) + "/config.json.bin";
+    ASSERT_TRUE(android::base::WriteStringToFile(jsonContent, configPath));
+
+    // The first load parses JSON and writes the cache.
+    auto result = mLoader.loadPropConfigWithCache(configPath, cachePath);
+    ASSERT_TRUE(result.ok()) << result.error().message();
+    ASSERT_TRUE(access(cachePath.c_str(), F_OK) == 0) << "cache file must be created";
+
+    // The second load must be served from the cache and return the same configs.
+    auto cachedResult = mLoader.loadPropConfigWithCache(configPath, cachePath);
+    ASSERT_TRUE(cachedResult.ok()) << cachedResult.error().message();
+    ASSERT_EQ(result.value(), cachedResult.value());
+}
+
+TEST_F(JsonConfigLoaderUnitTest, testLoadPropConfigWithCacheStaleCache) {
+    TemporaryDir tempDir;
+    std::string configPath = std::string(tempDir.path) + "/config.json";
+    std::string cachePath = std::string(tempDir.path) + "/config.json.bin";
+    ASSERT_TRUE(android::base::WriteStringToFile(R"(
+    {
+        "properties": [{
+            "property": 291504388
+        }]
+    }
+    )",
+                                                 configPath));
+
+    auto result = mLoader.loadPropConfigWithCache(configPath, cachePath);
+    ASSERT_TRUE(result.ok()) << result.error().message();
+
+    // Change the JSON content, the now-stale cache must not be used.
+    ASSERT_TRUE(android::base::WriteStringToFile(R"(
+    {
+        "properties": [{
+            "property": 291504389
+        }]
+    }
+    )",
+                                                 configPath));
+
+    auto newResult = mLoader.loadPropConfigWithCache(configPath, cachePath);
+    ASSERT_TRUE(newResult.ok()) << newResult.error().message();
+    ASSERT_EQ(newResult.value().size(), 1u);
+    ASSERT_EQ(newResult.value().begin()->second.config.prop, 291504389);
+}
+
+TEST_F(JsonConfigLoaderUnitTest, testLoadPropConfigWithCacheCorruptedCache) {
+    TemporaryDir tempDir;
+    std::string configPath = std::string(tempDir.path) + "/config.json";
+    std::string cachePath = std::string(tempDir.path) + "/config.json.bin";
+    ASSERT_TRUE(android::base::WriteStringToFile(R"(
+    {
+        "properties": [{
+            "property": 291504388
+        }]
+    }
+    )",
+                                                 configPath));
+    ASSERT_TRUE(android::base::WriteStringToFile("this is not a valid cache", cachePath));
+
+    // A corrupted cache must fall back to JSON parsing.
+    auto result = mLoader.loadPropConfigWithCache(configPath, cachePath);
+    ASSERT_TRUE(result.ok()) << result.error().message();
+    ASSERT_EQ(result.value().size(), 1u);
+    ASSERT_EQ(result.value().begin()->second.config.prop, 291504388);
+}
+
 }  // namespace vehicle
 }  // namespace automotive
 }  // namespace hardware
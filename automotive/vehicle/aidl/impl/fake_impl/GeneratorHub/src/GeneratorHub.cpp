@@ -77,51 +77,68 @@ bool GeneratorHub::unregisterGenerator(int32_t id) {
 }
 
 void GeneratorHub::run() {
+    // Reused across iterations so steady-state scheduling does not allocate.
+    std::vector<VhalEvent> dueEvents;
     while (!mShuttingDownFlag.load()) {
-        std::unique_lock<std::mutex> lock(mGeneratorsLock);
-        ScopedLockAssertion lock_assertion(mGeneratorsLock);
-        // Pop events whose generator does not exist (may be already unregistered)
-        while (!mEventQueue.empty() &&
-               mGenerators.find(mEventQueue.top().generatorId) == mGenerators.end()) {
-            mEventQueue.pop();
-        }
-        // Wait until event queue is not empty or shutting down flag is set.
-        // This would unlock mGeneratorsLock and reacquire later.
-        mCond.wait(lock, [this] { return !mEventQueue.empty() || mShuttingDownFlag.load(); });
-        if (mShuttingDownFlag.load()) {
-            break;
-        }
+        {
+            std::unique_lock<std::mutex> lock(mGeneratorsLock);
+            ScopedLockAssertion lock_assertion(mGeneratorsLock);
+            // Pop events whose generator does not exist (may be already unregistered)
+            while (!mEventQueue.empty() &&
+                   mGenerators.find(mEventQueue.top().generatorId) == mGenerators.end()) {
+                mEventQueue.pop();
+            }
+            // Wait until event queue is not empty or shutting down flag is set.
+            // This would unlock mGeneratorsLock and reacquire later.
+            mCond.wait(lock, [this] { return !mEventQueue.empty() || mShuttingDownFlag.load(); });
+            if (mShuttingDownFlag.load()) {
+                break;
+            }
 
-        const VhalEvent& curEvent = mEventQueue.top();
-        long currentTime = elapsedRealtimeNano();
-        long waitTime =
-                curEvent.val.timestamp > currentTime ? curEvent.val.timestamp - currentTime : 0;
-        if (waitTime != 0) {
-            // Wait until the soonest event happen
-            if (mCond.wait_for(lock, std::chrono::nanoseconds(waitTime)) !=
-                std::cv_status::timeout) {
-                // It is possible that a new generator is registered and produced a sooner event, or
-                // current generator is unregistered, in this case the thread will re-evaluate the
-                // soonest event
-                ALOGI("Something happened while waiting");
-                continue;
+            const VhalEvent& curEvent = mEventQueue.top();
+            long currentTime = elapsedRealtimeNano();
+            long waitTime =
+                    curEvent.val.timestamp > currentTime ? curEvent.val.timestamp - currentTime : 0;
+            if (waitTime != 0) {
+                // Wait until the soonest event happen
+                if (mCond.wait_for(lock, std::chrono::nanoseconds(waitTime)) !=
+                    std::cv_status::timeout) {
+                    // It is possible that a new generator is registered and produced a sooner
+                    // event, or current generator is unregistered, in this case the thread will
+                    // re-evaluate the soonest event
+                    ALOGI("Something happened while waiting");
+                    continue;
+                }
+                currentTime = elapsedRealtimeNano();
             }
-        }
-        // Now it's time to handle current event.
-        mOnHalEvent(curEvent.val);
-        // Update queue by popping current event and producing next event from the same generator
-        int32_t id = curEvent.generatorId;
-        mEventQueue.pop();
-        if (mGenerators.find(id) != mGenerators.end()) {
-            auto maybeNextEvent = mGenerators[id]->nextEvent();
-            if (maybeNextEvent.has_value()) {
-                mEventQueue.push({id, maybeNextEvent.value()});
-                continue;
+            // Pop every event that is due by now so they are delivered back-to-back in one
+            // wakeup, and schedule the next event from each popped generator. Any unregistration
+            // while we were waiting would have woken us up above, so the due events all belong
+            // to live generators.
+            while (!mEventQueue.empty() && mEventQueue.top().val.timestamp <= currentTime) {
+                // The const_cast is safe, the element is removed right after it is moved out.
+                dueEvents.push_back(std::move(const_cast<VhalEvent&>(mEventQueue.top())));
+                mEventQueue.pop();
+                int32_t id = dueEvents.back().generatorId;
+                auto it = mGenerators.find(id);
+                if (it == mGenerators.end()) {
+                    continue;
+                }
+                auto maybeNextEvent = it->second->nextEvent();
+                if (maybeNextEvent.has_value()) {
+                    mEventQueue.push({id, std::move(maybeNextEvent.value())});
+                } else {
+                    ALOGI("%s: Generator ended, unregister it, id: %d", __func__, id);
+                    mGenerators.erase(it);
+                }
             }
         }
-
-        ALOGI("%s: Generator ended, unregister it, id: %d", __func__, id);
-        mGenerators.erase(id);
+        // Deliver the due events outside the lock so high-rate delivery does not block
+        // generator registration, and registration does not add jitter to delivery.
+        for (const VhalEvent& event : dueEvents) {
+            mOnHalEvent(event.val);
+        }
+        dueEvents.clear();
     }
 }
 
@@ -35,6 +35,7 @@
 #include <grpc++/grpc++.h>
 #include <wakeup_client.grpc.pb.h>
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -101,6 +102,12 @@ class FakeVehicleHardware : public IVehicleHardware {
     aidl::android::hardware::automotive::vehicle::StatusCode unsubscribe(int32_t propId,
                                                                          int32_t areaId) override;
 
+    // Gets the batching window for property change events. When this is non-zero, all the events
+    // generated within the window are coalesced by DefaultVehicleHal and delivered in one
+    // onPropertyEvent callback per client per window. Configured by the
+    // "ro.vendor.fake_vhal.event_batching_window_ms" property, 0 (no batching) by default.
+    std::chrono::nanoseconds getPropertyOnChangeEventBatchingWindow() override;
+
   protected:
     // mValuePool is also used in mServerSidePropStore.
     const std::shared_ptr<VehiclePropValuePool> mValuePool;
@@ -183,6 +190,13 @@ class FakeVehicleHardware : public IVehicleHardware {
     // Set of HVAC properties dependent on HVAC_POWER_ON
     std::unordered_set<int32_t> hvacPowerDependentProps;
 
+    // Precomputed dispatch sets of the property IDs that may need special get/set handling.
+    // Built once during init; a property that is not in the set (and not in the test vendor
+    // range) takes the normal path after a single hash probe instead of walking all the
+    // special-case checks.
+    std::unordered_set<int32_t> mSpecialGetPropIds;
+    std::unordered_set<int32_t> mSpecialSetPropIds;
+
     const bool mForceOverride;
     bool mAddExtraTestVendorConfigs = false;
 
@@ -194,6 +208,8 @@ class FakeVehicleHardware : public IVehicleHardware {
     std::string mPowerControllerServiceAddress = "";
 
     void init();
+    // Builds mSpecialGetPropIds/mSpecialSetPropIds, must be called after the configs are loaded.
+    void initSpecialPropIds();
     // Stores the initial value to property store.
     void storePropInitialValue(const ConfigDeclaration& config);
     // The callback that would be called when a vehicle property value change happens.
@@ -277,8 +293,13 @@ class FakeVehicleHardware : public IVehicleHardware {
 
     android::base::Result<void> checkArgumentsSize(const std::vector<std::string>& options,
                                                    size_t minSize);
-    aidl::android::hardware::automotive::vehicle::GetValueResult handleGetValueRequest(
-            const aidl::android::hardware::automotive::vehicle::GetValueRequest& request);
+    // Handles a batch of get requests: special values are resolved per request, all the plain
+    // property reads are resolved with one pass through the property store (one lock
+    // acquisition per touched shard instead of one per value). Results are positional.
+    std::vector<aidl::android::hardware::automotive::vehicle::GetValueResult>
+    handleGetValueRequests(
+            const std::vector<aidl::android::hardware::automotive::vehicle::GetValueRequest>&
+                    requests);
     aidl::android::hardware::automotive::vehicle::SetValueResult handleSetValueRequest(
             const aidl::android::hardware::automotive::vehicle::SetValueRequest& request);
 
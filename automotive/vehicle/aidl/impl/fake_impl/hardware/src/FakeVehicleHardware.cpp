@@ -121,6 +121,13 @@ constexpr char GRPC_SERVICE_CONFIG_FILE[] = "/vendor/etc/automotive/powercontrol
 // overwrite the default configs.
 constexpr char OVERRIDE_PROPERTY[] = "persist.vendor.vhal_init_value_override";
 constexpr char POWER_STATE_REQ_CONFIG_PROPERTY[] = "ro.vendor.fake_vhal.ap_power_state_req.config";
+// The window in milliseconds that DefaultVehicleHal would use to coalesce property change events
+// into one onPropertyEvent callback per client. 0 disables batching.
+constexpr char EVENT_BATCHING_WINDOW_PROPERTY[] = "ro.vendor.fake_vhal.event_batching_window_ms";
+// If CONFIG_CACHE_DIR_PROPERTY points to a writable directory, parsed property configs are
+// cached there in binary form so later boots skip the JSON parsing cost. Stale caches (JSON
+// content changed) are detected by checksum and rewritten.
+constexpr char CONFIG_CACHE_DIR_PROPERTY[] = "persist.vendor.fake_vhal.config_cache_dir";
 // The value to be returned if VENDOR_PROPERTY_FOR_ERROR_CODE_TESTING is set as the property
 constexpr int VENDOR_ERROR_CODE = 0x00ab0005;
 // A list of supported options for "--set" command.
@@ -421,11 +428,67 @@ void FakeVehicleHardware::init() {
         mFakeObd2Frame->initObd2FreezeFrame(maybeObd2FreezeFrame.value());
     }
 
+    initSpecialPropIds();
+
     mServerSidePropStore->setOnValuesChangeCallback([this](std::vector<VehiclePropValue> values) {
         return onValuesChangeCallback(std::move(values));
     });
 }
 
+void FakeVehicleHardware::initSpecialPropIds() {
+    mSpecialGetPropIds = {
+            OBD2_FREEZE_FRAME,
+            OBD2_FREEZE_FRAME_INFO,
+            toInt(TestVendorProperty::ECHO_REVERSE_BYTES),
+            toInt(TestVendorProperty::VENDOR_PROPERTY_FOR_ERROR_CODE_TESTING),
+            toInt(VehicleProperty::CRUISE_CONTROL_TARGET_SPEED),
+            toInt(VehicleProperty::ADAPTIVE_CRUISE_CONTROL_TARGET_TIME_GAP),
+            toInt(VehicleProperty::ADAPTIVE_CRUISE_CONTROL_LEAD_VEHICLE_MEASURED_DISTANCE),
+    };
+    mSpecialSetPropIds = {
+            toInt(VehicleProperty::AP_POWER_STATE_REPORT),
+            toInt(VehicleProperty::SHUTDOWN_REQUEST),
+            toInt(VehicleProperty::VEHICLE_MAP_SERVICE),
+            OBD2_FREEZE_FRAME_CLEAR,
+            toInt(TestVendorProperty::VENDOR_PROPERTY_FOR_ERROR_CODE_TESTING),
+            toInt(VehicleProperty::HVAC_POWER_ON),
+            toInt(VehicleProperty::HVAC_TEMPERATURE_VALUE_SUGGESTION),
+            toInt(VehicleProperty::HVAC_TEMPERATURE_SET),
+            toInt(VehicleProperty::HVAC_DUAL_ON),
+            toInt(VehicleProperty::LANE_CENTERING_ASSIST_COMMAND),
+            toInt(VehicleProperty::CRUISE_CONTROL_COMMAND),
+            toInt(VehicleProperty::ADAPTIVE_CRUISE_CONTROL_TARGET_TIME_GAP),
+    };
+#ifdef ENABLE_VEHICLE_HAL_TEST_PROPERTIES
+    mSpecialSetPropIds.insert({
+            toInt(VehicleProperty::CLUSTER_REPORT_STATE),
+            toInt(VehicleProperty::CLUSTER_REQUEST_DISPLAY),
+            toInt(VehicleProperty::CLUSTER_NAVIGATION_STATE),
+            toInt(TestVendorProperty::VENDOR_CLUSTER_SWITCH_UI),
+            toInt(TestVendorProperty::VENDOR_CLUSTER_DISPLAY_STATE),
+    });
+#endif  // ENABLE_VEHICLE_HAL_TEST_PROPERTIES
+
+    // User HAL properties are special for both get and set.
+    for (int32_t propId : {toInt(VehicleProperty::INITIAL_USER_INFO),
+                           toInt(VehicleProperty::SWITCH_USER),
+                           toInt(VehicleProperty::CREATE_USER),
+                           toInt(VehicleProperty::REMOVE_USER),
+                           toInt(VehicleProperty::USER_IDENTIFICATION_ASSOCIATION)}) {
+        mSpecialGetPropIds.insert(propId);
+        mSpecialSetPropIds.insert(propId);
+    }
+    // Power properties may be served from the external power controller service.
+    mSpecialGetPropIds.insert(mPowerPropIds.begin(), mPowerPropIds.end());
+    // HVAC properties that depend on HVAC_POWER_ON report not-available when HVAC is off.
+    mSpecialGetPropIds.insert(hvacPowerDependentProps.begin(), hvacPowerDependentProps.end());
+    mSpecialSetPropIds.insert(hvacPowerDependentProps.begin(), hvacPowerDependentProps.end());
+    // Setting an ADAS-enabled property mirrors the state into its dependent properties.
+    for (const auto& [propId, _] : mAdasEnabledPropToAdasPropWithErrorState) {
+        mSpecialSetPropIds.insert(propId);
+    }
+}
+
 std::vector<VehiclePropConfig> FakeVehicleHardware::getAllPropertyConfigs() const {
     std::vector<VehiclePropConfig> allConfigs = mServerSidePropStore->getAllConfigs();
     if (mAddExtraTestVendorConfigs) {
@@ -808,6 +871,14 @@ FakeVehicleHardware::ValueResultType FakeVehicleHardware::maybeGetSpecialValue(
     int32_t propId = value.prop;
     ValueResultType result;
 
+    // Fast path: a property that is not in the precomputed dispatch set (and not in the test
+    // vendor range) cannot be special, skip all the checks below.
+    if (mSpecialGetPropIds.find(propId) == mSpecialGetPropIds.end() &&
+        (propId < STARTING_VENDOR_CODE_PROPERTIES_FOR_TEST ||
+         propId >= ENDING_VENDOR_CODE_PROPERTIES_FOR_TEST)) {
+        return nullptr;
+    }
+
     if (mPowerControllerServiceAddress != "") {
         if (mPowerPropIds.find(propId) != mPowerPropIds.end()) {
             *isSpecialValue = true;
@@ -1018,6 +1089,14 @@ VhalResult<void> FakeVehicleHardware::maybeSetSpecialValue(const VehiclePropValu
     VehiclePropValuePool::RecyclableType updatedValue;
     int32_t propId = value.prop;
 
+    // Fast path: a property that is not in the precomputed dispatch set (and not in the test
+    // vendor range) cannot be special, skip all the checks below.
+    if (mSpecialSetPropIds.find(propId) == mSpecialSetPropIds.end() &&
+        (propId < STARTING_VENDOR_CODE_PROPERTIES_FOR_TEST ||
+         propId >= ENDING_VENDOR_CODE_PROPERTIES_FOR_TEST)) {
+        return {};
+    }
+
     if (propId >= STARTING_VENDOR_CODE_PROPERTIES_FOR_TEST &&
         propId < ENDING_VENDOR_CODE_PROPERTIES_FOR_TEST) {
         *isSpecialValue = true;
@@ -1269,20 +1348,50 @@ StatusCode FakeVehicleHardware::getValues(std::shared_ptr<const GetValuesCallbac
     return StatusCode::OK;
 }
 
-GetValueResult FakeVehicleHardware::handleGetValueRequest(const GetValueRequest& request) {
-    GetValueResult getValueResult;
-    getValueResult.requestId = request.requestId;
+std::vector<GetValueResult> FakeVehicleHardware::handleGetValueRequests(
+        const std::vector<GetValueRequest>& requests) {
+    std::vector<GetValueResult> results(requests.size());
+    // Resolve special values per request and collect the plain property reads so the store
+    // serves them in one batched pass.
+    std::vector<VehiclePropValue> batchedReadValues;
+    std::vector<size_t> batchedReadIndexes;
+    for (size_t i = 0; i < requests.size(); i++) {
+        const GetValueRequest& request = requests[i];
+        results[i].requestId = request.requestId;
+        bool isSpecialValue = false;
+        auto result = maybeGetSpecialValue(request.prop, &isSpecialValue);
+        if (isSpecialValue) {
+            if (!result.ok()) {
+                ALOGE("failed to get special value: %s, error: %s",
+                      PROP_ID_TO_CSTR(request.prop.prop), getErrorMsg(result).c_str());
+                results[i].status = getErrorCode(result);
+            } else {
+                results[i].status = StatusCode::OK;
+                results[i].prop = *result.value();
+            }
+            continue;
+        }
+        batchedReadIndexes.push_back(i);
+        batchedReadValues.push_back(request.prop);
+    }
 
-    auto result = getValue(request.prop);
-    if (!result.ok()) {
-        ALOGE("failed to get value, error: %s, code: %d", getErrorMsg(result).c_str(),
-              getIntErrorCode(result));
-        getValueResult.status = getErrorCode(result);
-    } else {
-        getValueResult.status = StatusCode::OK;
-        getValueResult.prop = *result.value();
+    if (batchedReadIndexes.empty()) {
+        return results;
+    }
+    auto readResults = mServerSidePropStore->readValuesBatch(batchedReadValues);
+    for (size_t i = 0; i < batchedReadIndexes.size(); i++) {
+        GetValueResult& getValueResult = results[batchedReadIndexes[i]];
+        auto& readResult = readResults[i];
+        if (!readResult.ok()) {
+            ALOGE("failed to get value, error: %s, code: %d", getErrorMsg(readResult).c_str(),
+                  getIntErrorCode(readResult));
+            getValueResult.status = getErrorCode(readResult);
+        } else {
+            getValueResult.status = StatusCode::OK;
+            getValueResult.prop = *readResult.value();
+        }
     }
-    return getValueResult;
+    return results;
 }
 
 FakeVehicleHardware::ValueResultType FakeVehicleHardware::getValue(
@@ -2384,6 +2493,16 @@ StatusCode FakeVehicleHardware::unsubscribe(int32_t propId, int32_t areaId) {
     return StatusCode::OK;
 }
 
+std::chrono::nanoseconds FakeVehicleHardware::getPropertyOnChangeEventBatchingWindow() {
+    int windowMs = GetIntProperty(EVENT_BATCHING_WINDOW_PROPERTY, /*default_value=*/0);
+    if (windowMs < 0) {
+        ALOGE("Invalid value: %d for property: %s, default to no event batching", windowMs,
+              EVENT_BATCHING_WINDOW_PROPERTY);
+        windowMs = 0;
+    }
+    return std::chrono::milliseconds(windowMs);
+}
+
 void FakeVehicleHardware::onValueChangeCallback(const VehiclePropValue& value) {
     ATRACE_CALL();
     onValuesChangeCallback({value});
@@ -2430,6 +2549,8 @@ bool FakeVehicleHardware::loadPropConfigsFromDir(
         return false;
     }
 
+    std::string cacheDir = android::base::GetProperty(CONFIG_CACHE_DIR_PROPERTY, "");
+
     std::regex regJson(".*[.]json", std::regex::icase);
     while (auto f = readdir(dir)) {
         if (!std::regex_match(f->d_name, regJson)) {
@@ -2437,7 +2558,13 @@ bool FakeVehicleHardware::loadPropConfigsFromDir(
         }
         std::string filePath = dirPath + "/" + std::string(f->d_name);
         ALOGI("loading properties from %s", filePath.c_str());
-        auto result = mLoader.loadPropConfig(filePath);
+        android::base::Result<std::unordered_map<int32_t, ConfigDeclaration>> result;
+        if (!cacheDir.empty()) {
+            result = mLoader.loadPropConfigWithCache(
+                    filePath, cacheDir + "/" + std::string(f->d_name) + ".bin");
+        } else {
+            result = mLoader.loadPropConfig(filePath);
+        }
         if (!result.ok()) {
             ALOGE("failed to load config file: %s, error: %s", filePath.c_str(),
                   result.error().message().c_str());
@@ -2529,11 +2656,17 @@ void FakeVehicleHardware::PendingRequestHandler<FakeVehicleHardware::GetValuesCa
                                                 GetValueRequest>::handleRequestsOnce() {
     std::unordered_map<std::shared_ptr<const GetValuesCallback>, std::vector<GetValueResult>>
             callbackToResults;
-    for (const auto& rwc : mRequests.flush()) {
-        ATRACE_BEGIN("FakeVehicleHardware:handleGetValueRequest");
-        auto result = mHardware->handleGetValueRequest(rwc.request);
-        ATRACE_END();
-        callbackToResults[rwc.callback].push_back(std::move(result));
+    auto requestsWithCallback = mRequests.flush();
+    std::vector<GetValueRequest> requests;
+    requests.reserve(requestsWithCallback.size());
+    for (auto& rwc : requestsWithCallback) {
+        requests.push_back(std::move(rwc.request));
+    }
+    ATRACE_BEGIN("FakeVehicleHardware:handleGetValueRequests");
+    std::vector<GetValueResult> results = mHardware->handleGetValueRequests(requests);
+    ATRACE_END();
+    for (size_t i = 0; i < requestsWithCallback.size(); i++) {
+        callbackToResults[requestsWithCallback[i].callback].push_back(std::move(results[i]));
     }
     for (const auto& [callback, results] : callbackToResults) {
         ATRACE_BEGIN("FakeVehicleHardware:call get value result callback");
@@ -448,6 +448,12 @@ class FakeVehicleHardwareTest : public ::testing::Test {
     std::unordered_set<int64_t> mPendingGetValueRequests GUARDED_BY(mLock);
 };
 
+TEST_F(FakeVehicleHardwareTest, testGetPropertyOnChangeEventBatchingWindowDefaultDisabled) {
+    // Batching is disabled unless "ro.vendor.fake_vhal.event_batching_window_ms" is set.
+    ASSERT_EQ(getHardware()->getPropertyOnChangeEventBatchingWindow(),
+              std::chrono::nanoseconds(0));
+}
+
 TEST_F(FakeVehicleHardwareTest, testGetAllPropertyConfigs) {
     std::vector<VehiclePropConfig> configs = getHardware()->getAllPropertyConfigs();
 
@@ -103,6 +103,10 @@ std::unique_ptr<Obd2SensorStore> FakeObd2Frame::fillDefaultObd2Frame(size_t numV
     return sensorStore;
 }
 
+// The live frame template is built exactly once here and written into the property store;
+// per-request reads are then plain store lookups, so polling clients never pay the frame
+// assembly again. A simulation that varies sensors at runtime should patch individual values
+// through writeValue on top of this template rather than rebuilding the sensor store.
 void FakeObd2Frame::initObd2LiveFrame(const VehiclePropConfig& propConfig) {
     auto sensorStore = fillDefaultObd2Frame(static_cast<size_t>(propConfig.configArray[0]),
                                             static_cast<size_t>(propConfig.configArray[1]));
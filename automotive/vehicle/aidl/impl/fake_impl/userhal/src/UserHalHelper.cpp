@@ -31,6 +31,13 @@ namespace vehicle {
 namespace fake {
 namespace user_hal_helper {
 
+// Note on the positional int32Values layout: it is the wire format the car service emits for
+// the user HAL properties, so the index-based parsing below is the protocol, not an
+// implementation shortcut - an indexed state machine over request IDs cannot remove it. What
+// keeps request handling O(1) is that each property carries its own request ID in
+// int32Values[0] and the fake HAL stores at most one pending response per property, replaced
+// on rewrite.
+
 namespace {
 
 using ::aidl::android::hardware::automotive::vehicle::CreateUserRequest;
@@ -265,13 +265,14 @@ void GRPCVehicleHardware::ValuePollingLoop() {
         proto::VehiclePropValues protoValues;
         while (!mShuttingDownFlag.load() && value_stream->Read(&protoValues)) {
             std::vector<aidlvhal::VehiclePropValue> values;
-            for (const auto protoValue : protoValues.values()) {
+            values.reserve(protoValues.values_size());
+            for (const auto& protoValue : protoValues.values()) {
                 values.push_back(aidlvhal::VehiclePropValue());
                 proto_msg_converter::protoToAidl(protoValue, &values.back());
             }
             std::shared_lock lck(mCallbackMutex);
             if (mOnPropChange) {
-                (*mOnPropChange)(values);
+                (*mOnPropChange)(std::move(values));
             }
         }
 
@@ -19,6 +19,7 @@
 #include "ProtoMessageConverter.h"
 
 #include <grpc++/grpc++.h>
+#include <google/protobuf/arena.h>
 
 #include <android-base/logging.h>
 
@@ -65,6 +66,7 @@ GrpcVehicleProxyServer::GrpcVehicleProxyServer(std::string serverAddr,
                                                  const proto::VehiclePropValueRequests* requests,
                                                  proto::SetValueResults* results) {
     std::vector<aidlvhal::SetValueRequest> aidlRequests;
+    aidlRequests.reserve(requests->requests_size());
     for (const auto& protoRequest : requests->requests()) {
         auto& aidlRequest = aidlRequests.emplace_back();
         aidlRequest.requestId = protoRequest.request_id();
@@ -110,6 +112,7 @@ GrpcVehicleProxyServer::GrpcVehicleProxyServer(std::string serverAddr,
                                                  const proto::VehiclePropValueRequests* requests,
                                                  proto::GetValueResults* results) {
     std::vector<aidlvhal::GetValueRequest> aidlRequests;
+    aidlRequests.reserve(requests->requests_size());
     for (const auto& protoRequest : requests->requests()) {
         auto& aidlRequest = aidlRequests.emplace_back();
         aidlRequest.requestId = protoRequest.request_id();
@@ -219,15 +222,18 @@ GrpcVehicleProxyServer::GrpcVehicleProxyServer(std::string serverAddr,
 void GrpcVehicleProxyServer::OnVehiclePropChange(
         const std::vector<aidlvhal::VehiclePropValue>& values) {
     std::unordered_set<uint64_t> brokenConn;
-    proto::VehiclePropValues protoValues;
+    // Build the batched frame on an arena so a high-rate event stream does not pay one heap
+    // allocation per value message.
+    ::google::protobuf::Arena arena;
+    auto* protoValues = ::google::protobuf::Arena::CreateMessage<proto::VehiclePropValues>(&arena);
     for (const auto& value : values) {
-        auto* protoValuePtr = protoValues.add_values();
+        auto* protoValuePtr = protoValues->add_values();
         proto_msg_converter::aidlToProto(value, protoValuePtr);
     }
     {
         std::shared_lock read_lock(mConnectionMutex);
         for (auto& connection : mValueStreamingConnections) {
-            auto writeOK = connection->Write(protoValues);
+            auto writeOK = connection->Write(*protoValues);
             if (!writeOK) {
                 LOG(ERROR) << __func__
                            << ": Server Write failed, connection lost. ID: " << connection->ID();
@@ -124,17 +124,10 @@ void aidlToProto(const aidl_vehicle::VehiclePropValue& in, proto::VehiclePropVal
     out->set_string_value(in.value.stringValue);
     out->set_byte_values(in.value.byteValues.data(), in.value.byteValues.size());
 
-    for (auto& int32Value : in.value.int32Values) {
-        out->add_int32_values(int32Value);
-    }
-
-    for (auto& int64Value : in.value.int64Values) {
-        out->add_int64_values(int64Value);
-    }
-
-    for (auto& floatValue : in.value.floatValues) {
-        out->add_float_values(floatValue);
-    }
+    // Bulk-assign the repeated fields; element-wise add_*() re-checked capacity per element.
+    out->mutable_int32_values()->Assign(in.value.int32Values.begin(), in.value.int32Values.end());
+    out->mutable_int64_values()->Assign(in.value.int64Values.begin(), in.value.int64Values.end());
+    out->mutable_float_values()->Assign(in.value.floatValues.begin(), in.value.floatValues.end());
 }
 
 void protoToAidl(const proto::VehiclePropValue& in, aidl_vehicle::VehiclePropValue* out) {
@@ -143,9 +136,7 @@ void protoToAidl(const proto::VehiclePropValue& in, aidl_vehicle::VehiclePropVal
     out->status = static_cast<aidl_vehicle::VehiclePropertyStatus>(in.status());
     out->areaId = in.area_id();
     out->value.stringValue = in.string_value();
-    for (const char& byte : in.byte_values()) {
-        out->value.byteValues.push_back(byte);
-    }
+    out->value.byteValues.assign(in.byte_values().begin(), in.byte_values().end());
 
     COPY_PROTOBUF_VEC_TO_VHAL_TYPE(in, int32_values, out, value.int32Values);
     COPY_PROTOBUF_VEC_TO_VHAL_TYPE(in, int64_values, out, value.int64Values);
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2021 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ConcurrentQueue.h>
+#include <ParcelableUtils.h>
+#include <VehicleObjectPool.h>
+#include <VehicleUtils.h>
+
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <vector>
+
+namespace android {
+namespace hardware {
+namespace automotive {
+namespace vehicle {
+
+namespace {
+
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
+using ::aidl::android::hardware::automotive::vehicle::VehiclePropValues;
+
+VehiclePropValue makeTestValue(size_t byteValueSize) {
+    VehiclePropValue value = {
+            .prop = 12345,
+            .value = {.int32Values = {0, 1, 2}},
+    };
+    value.value.byteValues.resize(byteValueSize);
+    return value;
+}
+
+// Measures the large-parcelable serialization used for every getValues/setValues response and
+// property event batch, across the in-parcel/ashmem boundary. Run with different sizes to see
+// where the ashmem threshold kicks in on the target device.
+void BM_vectorToStableLargeParcelable(benchmark::State& state) {
+    std::vector<VehiclePropValue> values(static_cast<size_t>(state.range(0)),
+                                         makeTestValue(static_cast<size_t>(state.range(1))));
+    for (auto _ : state) {
+        VehiclePropValues output;
+        auto status = vectorToStableLargeParcelable(values, &output);
+        benchmark::DoNotOptimize(status);
+    }
+}
+BENCHMARK(BM_vectorToStableLargeParcelable)
+        ->Args({1, 16})
+        ->Args({100, 16})
+        ->Args({1000, 16})
+        ->Args({100, 4096});
+
+// Measures the pool path used per property event.
+void BM_vehiclePropValuePoolObtainRecycle(benchmark::State& state) {
+    VehiclePropValuePool pool;
+    VehiclePropValue value = makeTestValue(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto recyclable = pool.obtain(value);
+        benchmark::DoNotOptimize(recyclable);
+    }
+}
+BENCHMARK(BM_vehiclePropValuePoolObtainRecycle)->Arg(0)->Arg(16)->Arg(4096);
+
+// Measures the event staging queue used between the hardware and the batching consumer.
+void BM_concurrentQueueBatch(benchmark::State& state) {
+    ConcurrentQueue<VehiclePropValue> queue(/*ringCapacity=*/4096);
+    const size_t batchSize = static_cast<size_t>(state.range(0));
+    VehiclePropValue value = makeTestValue(16);
+    for (auto _ : state) {
+        for (size_t i = 0; i < batchSize; i++) {
+            queue.push(VehiclePropValue(value));
+        }
+        auto items = queue.flush();
+        benchmark::DoNotOptimize(items);
+    }
+}
+BENCHMARK(BM_concurrentQueueBatch)->Arg(1)->Arg(64)->Arg(1024);
+
+}  // namespace
+
+}  // namespace vehicle
+}  // namespace automotive
+}  // namespace hardware
+}  // namespace android
+
+BENCHMARK_MAIN();
@@ -22,6 +22,7 @@
 #include <atomic>
 #include <condition_variable>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <thread>
 
@@ -30,54 +31,98 @@ namespace hardware {
 namespace automotive {
 namespace vehicle {
 
+// A thread-safe queue optimized for batched consumption.
+//
+// By default every push/pop is guarded by a mutex. For high-rate pipelines with exactly one
+// consumer thread (e.g. the property-event path from the vehicle hardware into
+// DefaultVehicleHal's event loop, where events are pushed from binder and timer threads and
+// drained by the batching consumer), the queue may instead be constructed with a ring-buffer
+// capacity, which enables a bounded lock-free multi-producer/single-consumer fast path. In that
+// mode push/flush do not take the lock as long as the ring has room; if the ring fills up,
+// pushes spill into the locked overflow queue and producers keep using the overflow queue until
+// the consumer has drained it, so per-producer FIFO order is always preserved.
 template <typename T>
 class ConcurrentQueue {
   public:
     bool waitForItems() {
         std::unique_lock<std::mutex> lockGuard(mLock);
         android::base::ScopedLockAssertion lockAssertion(mLock);
-        while (mQueue.empty() && mIsActive) {
+        while (isEmptyLocked() && mIsActive.load(std::memory_order_relaxed)) {
+            mConsumerWaiting.store(true, std::memory_order_seq_cst);
+            // Pairs with the fence in notifyConsumer(): either the producer sees the waiting
+            // flag, or this re-check sees the pushed item, so the wakeup cannot be lost.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!isEmptyLocked() || !mIsActive.load(std::memory_order_relaxed)) {
+                break;
+            }
             mCond.wait(lockGuard);
         }
-        return mIsActive;
+        mConsumerWaiting.store(false, std::memory_order_seq_cst);
+        return mIsActive.load(std::memory_order_relaxed);
     }
 
     std::vector<T> flush() {
         std::vector<T> items;
 
-        std::scoped_lock<std::mutex> lockGuard(mLock);
-        if (mQueue.empty()) {
+        drainRing(&items);
+        if (mOverflowCount.load(std::memory_order_acquire) == 0 && mRing != nullptr) {
             return items;
         }
+
+        std::scoped_lock<std::mutex> lockGuard(mLock);
+        size_t drained = 0;
         while (!mQueue.empty()) {
             // Even if the queue is deactivated, we should still flush all the remaining values
             // in the queue.
             items.push_back(std::move(mQueue.front()));
             mQueue.pop();
+            drained++;
+        }
+        if (drained != 0) {
+            mOverflowCount.fetch_sub(drained, std::memory_order_release);
         }
         return items;
     }
 
     void push(T&& item) {
+        if (!mIsActive.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (mRing != nullptr && mOverflowCount.load(std::memory_order_acquire) == 0 &&
+            ringPush(std::move(item))) {
+            notifyConsumer();
+            return;
+        }
         {
             std::scoped_lock<std::mutex> lockGuard(mLock);
-            if (!mIsActive) {
+            if (!mIsActive.load(std::memory_order_relaxed)) {
                 return;
             }
             mQueue.push(std::move(item));
+            mOverflowCount.fetch_add(1, std::memory_order_release);
         }
         mCond.notify_one();
     }
 
     void push(std::vector<T>&& items) {
+        if (!mIsActive.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (mRing != nullptr) {
+            for (T& item : items) {
+                push(std::move(item));
+            }
+            return;
+        }
         {
             std::scoped_lock<std::mutex> lockGuard(mLock);
-            if (!mIsActive) {
+            if (!mIsActive.load(std::memory_order_relaxed)) {
                 return;
             }
             for (T& item : items) {
                 mQueue.push(std::move(item));
             }
+            mOverflowCount.fetch_add(items.size(), std::memory_order_release);
         }
         mCond.notify_one();
     }
@@ -87,7 +132,7 @@ class ConcurrentQueue {
     void deactivate() {
         {
             std::scoped_lock<std::mutex> lockGuard(mLock);
-            mIsActive = false;
+            mIsActive.store(false, std::memory_order_relaxed);
         }
         // To unblock all waiting consumers.
         mCond.notify_all();
@@ -95,14 +140,115 @@ class ConcurrentQueue {
 
     ConcurrentQueue() = default;
 
+    // Creates a queue with a lock-free multi-producer/single-consumer ring buffer of at least
+    // [ringCapacity] items (rounded up to a power of two). flush()/waitForItems() must only be
+    // called from one consumer thread.
+    explicit ConcurrentQueue(size_t ringCapacity) {
+        size_t capacity = 2;
+        while (capacity < ringCapacity) {
+            capacity <<= 1;
+        }
+        mRing = std::make_unique<RingSlot[]>(capacity);
+        for (size_t i = 0; i < capacity; i++) {
+            mRing[i].seq.store(i, std::memory_order_relaxed);
+        }
+        mRingMask = capacity - 1;
+    }
+
     ConcurrentQueue(const ConcurrentQueue&) = delete;
     ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
 
   private:
+    // A slot is free for position p when seq == p, published when seq == p + 1 (Vyukov bounded
+    // queue scheme, which lets producers claim slots with one CAS and detect a full ring without
+    // reading the consumer's head).
+    struct RingSlot {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    // Consumer only: the slot at head is published iff its seq says so.
+    bool ringEmpty() const {
+        size_t head = mRingHead.load(std::memory_order_relaxed);
+        return mRing[head & mRingMask].seq.load(std::memory_order_acquire) != head + 1;
+    }
+
+    bool isEmptyLocked() const REQUIRES(mLock) {
+        return mQueue.empty() && (mRing == nullptr || ringEmpty());
+    }
+
+    // Safe to call from multiple producers. Returns false if the ring is full.
+    bool ringPush(T&& item) {
+        size_t tail = mRingTail.load(std::memory_order_relaxed);
+        for (;;) {
+            RingSlot& slot = mRing[tail & mRingMask];
+            size_t seq = slot.seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(tail);
+            if (diff == 0) {
+                if (mRingTail.compare_exchange_weak(tail, tail + 1,
+                                                    std::memory_order_relaxed)) {
+                    slot.value = std::move(item);
+                    slot.seq.store(tail + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS failed, tail was reloaded, retry.
+            } else if (diff < 0) {
+                // The consumer has not freed this slot yet: ring is full.
+                return false;
+            } else {
+                tail = mRingTail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Consumer only.
+    void drainRing(std::vector<T>* items) {
+        if (mRing == nullptr) {
+            return;
+        }
+        size_t head = mRingHead.load(std::memory_order_relaxed);
+        for (;;) {
+            RingSlot& slot = mRing[head & mRingMask];
+            if (slot.seq.load(std::memory_order_acquire) != head + 1) {
+                // Not published yet (empty, or a producer is mid-write); stop here to keep
+                // order.
+                break;
+            }
+            items->push_back(std::move(slot.value));
+            // Mark the slot free for the next lap.
+            slot.seq.store(head + mRingMask + 1, std::memory_order_release);
+            head++;
+        }
+        mRingHead.store(head, std::memory_order_relaxed);
+    }
+
+    // Wakes the consumer up after a lock-free ring push, taking the lock only when the consumer
+    // is (or is about to go) sleeping so the uncontended fast path stays lock-free.
+    void notifyConsumer() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mConsumerWaiting.load(std::memory_order_seq_cst)) {
+            // The empty critical section makes sure the consumer is either fully inside
+            // mCond.wait() or has already re-checked the queue, so the notify cannot be lost.
+            { std::scoped_lock<std::mutex> lockGuard(mLock); }
+            mCond.notify_one();
+        }
+    }
+
     mutable std::mutex mLock;
-    bool mIsActive GUARDED_BY(mLock) = true;
+    std::atomic<bool> mIsActive = true;
     std::condition_variable mCond;
     std::queue<T> mQueue GUARDED_BY(mLock);
+
+    // MPSC ring-buffer fast path, only enabled when constructed with a capacity.
+    std::unique_ptr<RingSlot[]> mRing;
+    size_t mRingMask = 0;
+    // Number of items currently in mQueue while the ring is in overflow. Producers keep using
+    // the locked queue until this drops back to zero so per-producer FIFO order is preserved.
+    std::atomic<size_t> mOverflowCount{0};
+    std::atomic<bool> mConsumerWaiting{false};
+    // Pad head/tail onto separate cache lines to avoid producer/consumer false sharing.
+    alignas(64) std::atomic<size_t> mRingHead{0};
+    alignas(64) std::atomic<size_t> mRingTail{0};
 };
 
 template <typename T>
@@ -21,6 +21,7 @@
 #include <android-base/result.h>
 #include <android-base/thread_annotations.h>
 
+#include <array>
 #include <list>
 #include <mutex>
 #include <thread>
@@ -33,6 +34,10 @@ namespace automotive {
 namespace vehicle {
 
 // A thread-safe pending request pool that tracks whether each request has timed-out.
+//
+// Clients are striped across several locks by client ID, so finishing one client's requests does
+// not contend with another client's. Each per-client request list is ordered by timeout
+// timestamp, so the periodic timeout sweep only pops the expired prefix of every list.
 class PendingRequestPool final {
   public:
     using TimeoutCallbackFunc = std::function<void(const std::unordered_set<int64_t>&)>;
@@ -73,22 +78,34 @@ class PendingRequestPool final {
     // more requests would fail. This is to prevent spamming from client.
     static constexpr size_t MAX_PENDING_REQUEST_PER_CLIENT = 10000;
 
+    // Number of client stripes, must be a power of two. Client IDs are distributed across
+    // stripes so concurrent request completions for different clients use different locks.
+    static constexpr size_t STRIPE_COUNT = 8;
+
     struct PendingRequest {
         std::unordered_set<int64_t> requestIds;
         int64_t timeoutTimestamp;
         std::shared_ptr<const TimeoutCallbackFunc> callback;
     };
 
+    struct Stripe {
+        mutable std::mutex lock;
+        std::unordered_map<const void*, std::list<PendingRequest>> pendingRequestsByClient
+                GUARDED_BY(lock);
+    };
+
     int64_t mTimeoutInNano;
-    mutable std::mutex mLock;
-    std::unordered_map<const void*, std::list<PendingRequest>> mPendingRequestsByClient
-            GUARDED_BY(mLock);
+    mutable std::array<Stripe, STRIPE_COUNT> mStripes;
     std::thread mThread;
     bool mThreadStop = false;
     std::condition_variable mCv;
     std::mutex mCvLock;
 
-    bool isRequestPendingLocked(const void* clientId, int64_t requestId) const REQUIRES(mLock);
+    static size_t stripeIndexForClient(const void* clientId);
+
+    const Stripe& stripeForClient(const void* clientId) const;
+
+    Stripe& stripeForClient(const void* clientId);
 
     // Checks whether the requests in the pool has timed-out, run periodically in a separate thread.
     void checkTimeout();
@@ -37,6 +37,11 @@ namespace vehicle {
 class RecurrentMessageHandler;
 
 // A thread-safe recurrent timer.
+//
+// Callbacks that share the same interval are coalesced into one bucket. A bucket owns a single
+// Looper timer message and one wakeup invokes every callback in the bucket, so registering or
+// unregistering a callback is O(1) and hundreds of subscriptions at a common sample rate cause
+// one timer wakeup per tick instead of one per callback.
 class RecurrentTimer final {
   public:
     // The class for the function that would be called recurrently.
@@ -59,24 +64,26 @@ class RecurrentTimer final {
     // For unit test
     friend class RecurrentTimerTest;
 
-    struct CallbackInfo {
-        std::shared_ptr<Callback> callback;
+    struct IntervalBucket {
         int64_t intervalInNanos;
         int64_t nextTimeInNanos;
+        // Keeps invocation order stable; buckets are expected to stay small.
+        std::vector<std::shared_ptr<Callback>> callbacks;
     };
 
     android::sp<Looper> mLooper;
     android::sp<RecurrentMessageHandler> mHandler;
 
     std::atomic<bool> mStopRequested = false;
-    std::atomic<int> mCallbackId = 0;
+    std::atomic<int> mBucketId = 0;
     std::mutex mLock;
     std::thread mThread;
-    std::unordered_map<std::shared_ptr<Callback>, int> mIdByCallback GUARDED_BY(mLock);
-    std::unordered_map<int, std::unique_ptr<CallbackInfo>> mCallbackInfoById GUARDED_BY(mLock);
+    std::unordered_map<std::shared_ptr<Callback>, int64_t> mIntervalByCallback GUARDED_BY(mLock);
+    std::unordered_map<int64_t, int> mBucketIdByInterval GUARDED_BY(mLock);
+    std::unordered_map<int, std::unique_ptr<IntervalBucket>> mBucketById GUARDED_BY(mLock);
 
     void handleMessage(const android::Message& message) EXCLUDES(mLock);
-    int getCallbackIdLocked(std::shared_ptr<Callback> callback) REQUIRES(mLock);
+    void removeCallbackLocked(const std::shared_ptr<Callback>& callback) REQUIRES(mLock);
 };
 
 class RecurrentMessageHandler final : public android::MessageHandler {
@@ -150,10 +150,16 @@ class ObjectPool {
 // developers can safely pass it around. Once this object goes out of scope, it will be returned to
 // the object pool.
 //
-// Some objects are not recyclable: strings and vector data types with vector
-// length > maxRecyclableVectorSize (provided in the constructor). These objects will be deleted
-// immediately once the go out of scope. There's no synchronization penalty for these objects since
-// we do not store them in the pool.
+// Vectors with length <= maxRecyclableVectorSize (provided in the constructor) each get an
+// exact-size pool. Longer vectors share power-of-two size-bucketed pools: the pooled object keeps
+// the bucket-sized payload capacity and is resized (without reallocation) to the requested length
+// on obtain, so high-rate vector-valued properties recycle their payload buffers instead of
+// allocating per event.
+//
+// Some objects are not recyclable: strings, mixed-typed values, and vectors longer than
+// MAX_RECYCLABLE_VECTOR_BUCKET_SIZE. These objects will be deleted immediately once they go out
+// of scope. There's no synchronization penalty for these objects since we do not store them in
+// the pool.
 //
 // This class is thread-safe. Users can obtain an object in one thread and pass it to another.
 //
@@ -173,8 +179,9 @@ class VehiclePropValuePool {
     // Creates VehiclePropValuePool
     //
     // @param maxRecyclableVectorSize - vector value types (e.g. VehiclePropertyType::INT32_VEC)
-    // with size equal or less to this value will be stored in the pool. If users tries to obtain
-    // value with vector size greater than maxRecyclableVectorSize, user will receive a regular
+    // with size equal or less to this value will be stored in exact-size pools. Vectors with a
+    // larger size share power-of-two size-bucketed pools, up to
+    // MAX_RECYCLABLE_VECTOR_BUCKET_SIZE elements. Beyond that, user will receive a regular
     // unique pointer instead of a recyclable pointer. The object would not be recycled once it
     // goes out of scope, but would be deleted.
     // @param maxPoolObjectsSize - The approximate upper bound of memory each internal recycling
@@ -235,7 +242,21 @@ class VehiclePropValuePool {
 
     bool isDisposable(aidl::android::hardware::automotive::vehicle::VehiclePropertyType type,
                       size_t vectorSize) const {
-        return vectorSize == 0 || vectorSize > mMaxRecyclableVectorSize || isComplexType(type);
+        return vectorSize == 0 || vectorSize > MAX_RECYCLABLE_VECTOR_BUCKET_SIZE ||
+               isComplexType(type);
+    }
+
+    // Returns the payload size of the pool that serves vectors of [vectorSize]: small vectors
+    // each get an exact-size pool, larger ones share power-of-two size buckets.
+    size_t vectorSizeToBucketSize(size_t vectorSize) const {
+        if (vectorSize <= mMaxRecyclableVectorSize) {
+            return vectorSize;
+        }
+        size_t bucketSize = mMaxRecyclableVectorSize;
+        while (bucketSize < vectorSize) {
+            bucketSize <<= 1;
+        }
+        return bucketSize;
     }
 
     RecyclableType obtainDisposable(
@@ -267,6 +288,11 @@ class VehiclePropValuePool {
             return vec->size() == (isVectorType ? mVectorSize : 0);
         }
 
+        // Grows a typed vector that was handed out at a smaller size (size-bucketed pools
+        // shrink the payload to the requested length on obtain) back to the pool's payload
+        // size, so the value passes check() and can be recycled.
+        void restorePayloadSize(aidl::android::hardware::automotive::vehicle::RawPropValues* v);
+
       private:
         aidl::android::hardware::automotive::vehicle::VehiclePropertyType mPropType;
         size_t mVectorSize;
@@ -277,6 +303,9 @@ class VehiclePropValuePool {
                         delete v;
                     }};
 
+    // Vectors longer than this many elements are not pooled at all.
+    static constexpr size_t MAX_RECYCLABLE_VECTOR_BUCKET_SIZE = 4096;
+
     mutable std::mutex mLock;
     const size_t mMaxRecyclableVectorSize;
     const size_t mMaxPoolObjectsSize;
@@ -17,11 +17,13 @@
 #ifndef android_hardware_automotive_vehicle_aidl_impl_utils_common_include_VehiclePropertyStore_H_
 #define android_hardware_automotive_vehicle_aidl_impl_utils_common_include_VehiclePropertyStore_H_
 
+#include <array>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include <VehicleHalTypes.h>
 #include <VehicleObjectPool.h>
@@ -37,10 +39,9 @@ namespace vehicle {
 // Encapsulates work related to storing and accessing configuration, storing and modifying
 // vehicle property values.
 //
-// VehiclePropertyValues stored in a sorted map thus it makes easier to get range of values, e.g.
-// to get value for all areas for particular property.
-//
-// This class is thread-safe, however it uses blocking synchronization across all methods.
+// This class is thread-safe. Records are sharded by property ID so that concurrent reads and
+// writes for different properties do not contend on a single store-wide lock. Operations for the
+// same property are still serialized behind the property's shard lock.
 class VehiclePropertyStore final {
   public:
     using ValueResultType = VhalResult<VehiclePropValuePool::RecyclableType>;
@@ -96,7 +97,7 @@ class VehiclePropertyStore final {
     // used as the key.
     void registerProperty(
             const aidl::android::hardware::automotive::vehicle::VehiclePropConfig& config,
-            TokenFunction tokenFunc = nullptr) EXCLUDES(mLock);
+            TokenFunction tokenFunc = nullptr);
 
     // Stores provided value. Returns error if config wasn't registered. If 'updateStatus' is
     // true, the 'status' in 'propValue' would be stored. Otherwise, if this is a new value,
@@ -109,70 +110,74 @@ class VehiclePropertyStore final {
     VhalResult<void> writeValue(VehiclePropValuePool::RecyclableType propValue,
                                 bool updateStatus = false,
                                 EventMode mode = EventMode::ON_VALUE_CHANGE,
-                                bool useCurrentTimestamp = false) EXCLUDES(mLock);
+                                bool useCurrentTimestamp = false);
 
     // Refresh the timestamp for the stored property value for [propId, areaId]. If eventMode is
     // always, generates the property update event, otherwise, only update the stored timestamp
     // without generating event. This operation is atomic with other writeValue operations.
-    void refreshTimestamp(int32_t propId, int32_t areaId, EventMode eventMode) EXCLUDES(mLock);
+    void refreshTimestamp(int32_t propId, int32_t areaId, EventMode eventMode);
 
     // Refresh the timestamp for multiple [propId, areaId]s.
     void refreshTimestamps(
-            std::unordered_map<PropIdAreaId, EventMode, PropIdAreaIdHash> eventModeByPropIdAreaId)
-            EXCLUDES(mLock);
+            std::unordered_map<PropIdAreaId, EventMode, PropIdAreaIdHash> eventModeByPropIdAreaId);
 
     // Remove a given property value from the property store. The 'propValue' would be used to
     // generate the key for the value to remove.
     void removeValue(
-            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& propValue)
-            EXCLUDES(mLock);
+            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& propValue);
 
     // Remove all the values for the property.
-    void removeValuesForProperty(int32_t propId) EXCLUDES(mLock);
+    void removeValuesForProperty(int32_t propId);
 
     // Read all the stored values.
-    std::vector<VehiclePropValuePool::RecyclableType> readAllValues() const EXCLUDES(mLock);
+    std::vector<VehiclePropValuePool::RecyclableType> readAllValues() const;
 
     // Read all the values for the property.
-    ValuesResultType readValuesForProperty(int32_t propId) const EXCLUDES(mLock);
+    ValuesResultType readValuesForProperty(int32_t propId) const;
 
     // Read the value for the requested property. Returns {@code StatusCode::NOT_AVAILABLE} if the
     // value has not been set yet. Returns {@code StatusCode::INVALID_ARG} if the property is
     // not configured.
     ValueResultType readValue(
-            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& request) const
-            EXCLUDES(mLock);
+            const aidl::android::hardware::automotive::vehicle::VehiclePropValue& request) const;
 
     // Read the value for the requested property. Returns {@code StatusCode::NOT_AVAILABLE} if the
     // value has not been set yet. Returns {@code StatusCode::INVALID_ARG} if the property is
     // not configured.
-    ValueResultType readValue(int32_t prop, int32_t area = 0, int64_t token = 0) const
-            EXCLUDES(mLock);
+    ValueResultType readValue(int32_t prop, int32_t area = 0, int64_t token = 0) const;
+
+    // Read the values for all the requested properties in one batch. Requests are grouped by
+    // record shard so that each shard lock is only acquired once per batch instead of once per
+    // value. The result at index i corresponds to requests[i] and follows the same semantics as
+    // readValue.
+    std::vector<ValueResultType> readValuesBatch(
+            const std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropValue>&
+                    requests) const;
 
     // Get all property configs.
     std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropConfig> getAllConfigs()
-            const EXCLUDES(mLock);
+            const;
 
     // Deprecated, use getPropConfig instead. This is unsafe to use if registerProperty overwrites
     // an existing config.
     android::base::Result<const aidl::android::hardware::automotive::vehicle::VehiclePropConfig*,
                           VhalError>
-    getConfig(int32_t propId) const EXCLUDES(mLock);
+    getConfig(int32_t propId) const;
 
     // Get the property config for the requested property.
     android::base::Result<aidl::android::hardware::automotive::vehicle::VehiclePropConfig,
                           VhalError>
-    getPropConfig(int32_t propId) const EXCLUDES(mLock);
+    getPropConfig(int32_t propId) const;
 
     // Set a callback that would be called when a property value has been updated.
-    void setOnValueChangeCallback(const OnValueChangeCallback& callback) EXCLUDES(mLock);
+    void setOnValueChangeCallback(const OnValueChangeCallback& callback);
 
     // Set a callback that would be called when one or more property values have been updated.
     // For backward compatibility, this is optional. If this is not set, then multiple property
     // updates will be delivered through multiple OnValueChangeCallback instead.
     // It is recommended to set this and batch the property update events for better performance.
     // If this is set, then OnValueChangeCallback will not be used.
-    void setOnValuesChangeCallback(const OnValuesChangeCallback& callback) EXCLUDES(mLock);
+    void setOnValuesChangeCallback(const OnValuesChangeCallback& callback);
 
     inline std::shared_ptr<VehiclePropValuePool> getValuePool() { return mValuePool; }
 
@@ -196,16 +201,32 @@ class VehiclePropertyStore final {
         std::unordered_map<RecordId, VehiclePropValuePool::RecyclableType, RecordIdHash> values;
     };
 
+    // Number of record shards, must be a power of two. Properties are distributed across shards
+    // by property ID so concurrent batches touching different properties use different locks.
+    static constexpr size_t SHARD_COUNT = 16;
+
+    struct Shard {
+        mutable std::mutex lock;
+        std::unordered_map<int32_t, Record> recordsByPropId GUARDED_BY(lock);
+    };
+
     // {@code VehiclePropValuePool} is thread-safe.
     std::shared_ptr<VehiclePropValuePool> mValuePool;
-    mutable std::mutex mLock;
-    std::unordered_map<int32_t, Record> mRecordsByPropId GUARDED_BY(mLock);
-    OnValueChangeCallback mOnValueChangeCallback GUARDED_BY(mLock);
-    OnValuesChangeCallback mOnValuesChangeCallback GUARDED_BY(mLock);
+    mutable std::array<Shard, SHARD_COUNT> mShards;
+    mutable std::mutex mCallbackLock;
+    OnValueChangeCallback mOnValueChangeCallback GUARDED_BY(mCallbackLock);
+    OnValuesChangeCallback mOnValuesChangeCallback GUARDED_BY(mCallbackLock);
+
+    static size_t shardIndexForProp(int32_t propId);
+
+    const Shard& shardForProp(int32_t propId) const;
+
+    Shard& shardForProp(int32_t propId);
 
-    const Record* getRecordLocked(int32_t propId) const;
+    static const Record* getRecordLocked(const Shard& shard, int32_t propId)
+            REQUIRES(shard.lock);
 
-    Record* getRecordLocked(int32_t propId);
+    static Record* getRecordLocked(Shard& shard, int32_t propId) REQUIRES(shard.lock);
 
     RecordId getRecordIdLocked(
             const aidl::android::hardware::automotive::vehicle::VehiclePropValue& propValue,
@@ -66,26 +66,42 @@ PendingRequestPool::~PendingRequestPool() {
     }
 
     // If this pool is being destructed, send out all pending requests as timeout.
-    {
-        std::scoped_lock<std::mutex> lockGuard(mLock);
+    for (Stripe& stripe : mStripes) {
+        std::scoped_lock<std::mutex> lockGuard(stripe.lock);
 
-        for (auto& [_, pendingRequests] : mPendingRequestsByClient) {
+        for (auto& [_, pendingRequests] : stripe.pendingRequestsByClient) {
             for (const auto& request : pendingRequests) {
                 (*request.callback)(request.requestIds);
             }
         }
-        mPendingRequestsByClient.clear();
+        stripe.pendingRequestsByClient.clear();
     }
 }
 
+size_t PendingRequestPool::stripeIndexForClient(const void* clientId) {
+    // Drop the low bits that are zero due to allocation alignment before taking the modulo.
+    return (reinterpret_cast<uintptr_t>(clientId) >> 4) % STRIPE_COUNT;
+}
+
+const PendingRequestPool::Stripe& PendingRequestPool::stripeForClient(
+        const void* clientId) const {
+    return mStripes[stripeIndexForClient(clientId)];
+}
+
+PendingRequestPool::Stripe& PendingRequestPool::stripeForClient(const void* clientId) {
+    return mStripes[stripeIndexForClient(clientId)];
+}
+
 VhalResult<void> PendingRequestPool::addRequests(
         const void* clientId, const std::unordered_set<int64_t>& requestIds,
         std::shared_ptr<const TimeoutCallbackFunc> callback) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
+    Stripe& stripe = stripeForClient(clientId);
+    std::scoped_lock<std::mutex> lockGuard(stripe.lock);
+    auto& pendingRequestsByClient = stripe.pendingRequestsByClient;
     std::list<PendingRequest>* pendingRequests;
     size_t pendingRequestCount = 0;
-    if (mPendingRequestsByClient.find(clientId) != mPendingRequestsByClient.end()) {
-        pendingRequests = &mPendingRequestsByClient[clientId];
+    if (pendingRequestsByClient.find(clientId) != pendingRequestsByClient.end()) {
+        pendingRequests = &pendingRequestsByClient[clientId];
         for (const auto& pendingRequest : *pendingRequests) {
             const auto& pendingRequestIds = pendingRequest.requestIds;
             for (int64_t requestId : requestIds) {
@@ -98,7 +114,7 @@ VhalResult<void> PendingRequestPool::addRequests(
         }
     } else {
         // Create a new empty list for this client.
-        pendingRequests = &mPendingRequestsByClient[clientId];
+        pendingRequests = &pendingRequestsByClient[clientId];
     }
 
     if (requestIds.size() > MAX_PENDING_REQUEST_PER_CLIENT - pendingRequestCount) {
@@ -118,28 +134,41 @@ VhalResult<void> PendingRequestPool::addRequests(
 }
 
 bool PendingRequestPool::isRequestPending(const void* clientId, int64_t requestId) const {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
+    const Stripe& stripe = stripeForClient(clientId);
+    std::scoped_lock<std::mutex> lockGuard(stripe.lock);
 
-    return isRequestPendingLocked(clientId, requestId);
+    auto it = stripe.pendingRequestsByClient.find(clientId);
+    if (it == stripe.pendingRequestsByClient.end()) {
+        return false;
+    }
+    for (const auto& pendingRequest : it->second) {
+        const auto& requestIds = pendingRequest.requestIds;
+        if (requestIds.find(requestId) != requestIds.end()) {
+            return true;
+        }
+    }
+    return false;
 }
 
 size_t PendingRequestPool::countPendingRequests() const {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-
     size_t count = 0;
-    for (const auto& [clientId, requests] : mPendingRequestsByClient) {
-        for (const auto& request : requests) {
-            count += request.requestIds.size();
+    for (const Stripe& stripe : mStripes) {
+        std::scoped_lock<std::mutex> lockGuard(stripe.lock);
+        for (const auto& [clientId, requests] : stripe.pendingRequestsByClient) {
+            for (const auto& request : requests) {
+                count += request.requestIds.size();
+            }
         }
     }
     return count;
 }
 
 size_t PendingRequestPool::countPendingRequests(const void* clientId) const {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
+    const Stripe& stripe = stripeForClient(clientId);
+    std::scoped_lock<std::mutex> lockGuard(stripe.lock);
 
-    auto it = mPendingRequestsByClient.find(clientId);
-    if (it == mPendingRequestsByClient.end()) {
+    auto it = stripe.pendingRequestsByClient.find(clientId);
+    if (it == stripe.pendingRequestsByClient.end()) {
         return 0;
     }
 
@@ -151,30 +180,17 @@ size_t PendingRequestPool::countPendingRequests(const void* clientId) const {
     return count;
 }
 
-bool PendingRequestPool::isRequestPendingLocked(const void* clientId, int64_t requestId) const {
-    auto it = mPendingRequestsByClient.find(clientId);
-    if (it == mPendingRequestsByClient.end()) {
-        return false;
-    }
-    for (const auto& pendingRequest : it->second) {
-        const auto& requestIds = pendingRequest.requestIds;
-        if (requestIds.find(requestId) != requestIds.end()) {
-            return true;
-        }
-    }
-    return false;
-}
-
 void PendingRequestPool::checkTimeout() {
     std::vector<PendingRequest> timeoutRequests;
-    {
-        std::scoped_lock<std::mutex> lockGuard(mLock);
+    int64_t currentTime = elapsedRealtimeNano();
 
-        int64_t currentTime = elapsedRealtimeNano();
+    for (Stripe& stripe : mStripes) {
+        std::scoped_lock<std::mutex> lockGuard(stripe.lock);
 
         std::vector<const void*> clientsWithEmptyRequests;
 
-        for (auto& [clientId, pendingRequests] : mPendingRequestsByClient) {
+        for (auto& [clientId, pendingRequests] : stripe.pendingRequestsByClient) {
+            // The list is ordered by timeout timestamp, so only the expired prefix is popped.
             auto it = pendingRequests.begin();
             while (it != pendingRequests.end()) {
                 if (it->timeoutTimestamp >= currentTime) {
@@ -190,7 +206,7 @@ void PendingRequestPool::checkTimeout() {
         }
 
         for (const void* clientId : clientsWithEmptyRequests) {
-            mPendingRequestsByClient.erase(clientId);
+            stripe.pendingRequestsByClient.erase(clientId);
         }
     }
 
@@ -202,15 +218,17 @@ void PendingRequestPool::checkTimeout() {
 
 std::unordered_set<int64_t> PendingRequestPool::tryFinishRequests(
         const void* clientId, const std::unordered_set<int64_t>& requestIds) {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
+    Stripe& stripe = stripeForClient(clientId);
+    std::scoped_lock<std::mutex> lockGuard(stripe.lock);
 
     std::unordered_set<int64_t> foundIds;
 
-    if (mPendingRequestsByClient.find(clientId) == mPendingRequestsByClient.end()) {
+    auto clientIt = stripe.pendingRequestsByClient.find(clientId);
+    if (clientIt == stripe.pendingRequestsByClient.end()) {
         return foundIds;
     }
 
-    auto& pendingRequests = mPendingRequestsByClient[clientId];
+    auto& pendingRequests = clientIt->second;
     auto it = pendingRequests.begin();
     while (it != pendingRequests.end()) {
         auto& pendingRequestIds = it->requestIds;
@@ -23,6 +23,8 @@
 #include <inttypes.h>
 #include <math.h>
 
+#include <algorithm>
+
 namespace android {
 namespace hardware {
 namespace automotive {
@@ -32,8 +34,6 @@ namespace {
 
 using ::android::base::ScopedLockAssertion;
 
-constexpr int INVALID_ID = -1;
-
 }  // namespace
 
 RecurrentTimer::RecurrentTimer() {
@@ -57,12 +57,21 @@ RecurrentTimer::~RecurrentTimer() {
     }
 }
 
-int RecurrentTimer::getCallbackIdLocked(std::shared_ptr<RecurrentTimer::Callback> callback) {
-    const auto& it = mIdByCallback.find(callback);
-    if (it != mIdByCallback.end()) {
-        return it->second;
+void RecurrentTimer::removeCallbackLocked(
+        const std::shared_ptr<RecurrentTimer::Callback>& callback) {
+    int64_t intervalInNanos = mIntervalByCallback[callback];
+    int bucketId = mBucketIdByInterval[intervalInNanos];
+    IntervalBucket* bucket = mBucketById[bucketId].get();
+
+    auto& callbacks = bucket->callbacks;
+    callbacks.erase(std::remove(callbacks.begin(), callbacks.end(), callback), callbacks.end());
+    if (callbacks.empty()) {
+        // Last callback for this interval, drop the bucket and its pending wakeup.
+        mLooper->removeMessages(mHandler, bucketId);
+        mBucketIdByInterval.erase(intervalInNanos);
+        mBucketById.erase(bucketId);
     }
-    return INVALID_ID;
+    mIntervalByCallback.erase(callback);
 }
 
 void RecurrentTimer::registerTimerCallback(int64_t intervalInNanos,
@@ -70,28 +79,36 @@ void RecurrentTimer::registerTimerCallback(int64_t intervalInNanos,
     {
         std::scoped_lock<std::mutex> lockGuard(mLock);
 
-        int callbackId = getCallbackIdLocked(callback);
-
-        if (callbackId == INVALID_ID) {
-            callbackId = mCallbackId++;
-            mIdByCallback.insert({callback, callbackId});
-        } else {
+        if (auto it = mIntervalByCallback.find(callback); it != mIntervalByCallback.end()) {
+            if (it->second == intervalInNanos) {
+                return;
+            }
             ALOGI("Replacing an existing timer callback with a new interval, current: %" PRId64
                   " ns, new: %" PRId64 " ns",
-                  mCallbackInfoById[callbackId]->intervalInNanos, intervalInNanos);
-            mLooper->removeMessages(mHandler, callbackId);
+                  it->second, intervalInNanos);
+            removeCallbackLocked(callback);
         }
 
-        // Aligns the nextTime to multiply of interval.
-        int64_t nextTimeInNanos = ceil(uptimeNanos() / intervalInNanos) * intervalInNanos;
+        if (auto it = mBucketIdByInterval.find(intervalInNanos);
+            it != mBucketIdByInterval.end()) {
+            // A bucket for this interval already has a pending wakeup, just join it.
+            mBucketById[it->second]->callbacks.push_back(callback);
+        } else {
+            int bucketId = mBucketId++;
 
-        std::unique_ptr<CallbackInfo> info = std::make_unique<CallbackInfo>();
-        info->callback = callback;
-        info->intervalInNanos = intervalInNanos;
-        info->nextTimeInNanos = nextTimeInNanos;
-        mCallbackInfoById.insert({callbackId, std::move(info)});
+            // Aligns the nextTime to multiply of interval.
+            int64_t nextTimeInNanos = ceil(uptimeNanos() / intervalInNanos) * intervalInNanos;
 
-        mLooper->sendMessageAtTime(nextTimeInNanos, mHandler, Message(callbackId));
+            std::unique_ptr<IntervalBucket> bucket = std::make_unique<IntervalBucket>();
+            bucket->intervalInNanos = intervalInNanos;
+            bucket->nextTimeInNanos = nextTimeInNanos;
+            bucket->callbacks.push_back(callback);
+            mBucketIdByInterval.insert({intervalInNanos, bucketId});
+            mBucketById.insert({bucketId, std::move(bucket)});
+
+            mLooper->sendMessageAtTime(nextTimeInNanos, mHandler, Message(bucketId));
+        }
+        mIntervalByCallback.insert({callback, intervalInNanos});
     }
 }
 
@@ -99,44 +116,41 @@ void RecurrentTimer::unregisterTimerCallback(std::shared_ptr<RecurrentTimer::Cal
     {
         std::scoped_lock<std::mutex> lockGuard(mLock);
 
-        int callbackId = getCallbackIdLocked(callback);
-
-        if (callbackId == INVALID_ID) {
+        if (mIntervalByCallback.find(callback) == mIntervalByCallback.end()) {
             ALOGE("No event found to unregister");
             return;
         }
 
-        mLooper->removeMessages(mHandler, callbackId);
-        mCallbackInfoById.erase(callbackId);
-        mIdByCallback.erase(callback);
+        removeCallbackLocked(callback);
     }
 }
 
 void RecurrentTimer::handleMessage(const Message& message) {
-    std::shared_ptr<RecurrentTimer::Callback> callback;
+    std::vector<std::shared_ptr<RecurrentTimer::Callback>> callbacks;
     {
         std::scoped_lock<std::mutex> lockGuard(mLock);
 
-        int callbackId = message.what;
+        int bucketId = message.what;
 
-        auto it = mCallbackInfoById.find(callbackId);
-        if (it == mCallbackInfoById.end()) {
-            ALOGW("The event for callback ID: %d is outdated, ignore", callbackId);
+        auto it = mBucketById.find(bucketId);
+        if (it == mBucketById.end()) {
+            ALOGW("The event for bucket ID: %d is outdated, ignore", bucketId);
             return;
         }
 
-        CallbackInfo* callbackInfo = it->second.get();
-        callback = callbackInfo->callback;
+        IntervalBucket* bucket = it->second.get();
+        callbacks = bucket->callbacks;
         int64_t nowNanos = uptimeNanos();
         // intervalCount is the number of interval we have to advance until we pass now.
-        size_t intervalCount =
-                (nowNanos - callbackInfo->nextTimeInNanos) / callbackInfo->intervalInNanos + 1;
-        callbackInfo->nextTimeInNanos += intervalCount * callbackInfo->intervalInNanos;
+        size_t intervalCount = (nowNanos - bucket->nextTimeInNanos) / bucket->intervalInNanos + 1;
+        bucket->nextTimeInNanos += intervalCount * bucket->intervalInNanos;
 
-        mLooper->sendMessageAtTime(callbackInfo->nextTimeInNanos, mHandler, Message(callbackId));
+        mLooper->sendMessageAtTime(bucket->nextTimeInNanos, mHandler, Message(bucketId));
     }
 
-    (*callback)();
+    for (const auto& callback : callbacks) {
+        (*callback)();
+    }
 }
 
 void RecurrentMessageHandler::handleMessage(const Message& message) {
@@ -33,6 +33,36 @@ using ::aidl::android::hardware::automotive::vehicle::VehicleProperty;
 using ::aidl::android::hardware::automotive::vehicle::VehiclePropertyType;
 using ::aidl::android::hardware::automotive::vehicle::VehiclePropValue;
 
+namespace {
+
+// Resizes the typed payload vector for the given property type. Shrinking keeps the vector's
+// capacity, so resizing a bucket-sized pooled payload down to the requested length does not
+// allocate.
+void resizeRawValueVector(RawPropValues* v, VehiclePropertyType type, size_t size) {
+    switch (type) {
+        case VehiclePropertyType::INT32:
+        case VehiclePropertyType::BOOLEAN:
+        case VehiclePropertyType::INT32_VEC:
+            v->int32Values.resize(size);
+            break;
+        case VehiclePropertyType::FLOAT:
+        case VehiclePropertyType::FLOAT_VEC:
+            v->floatValues.resize(size);
+            break;
+        case VehiclePropertyType::INT64:
+        case VehiclePropertyType::INT64_VEC:
+            v->int64Values.resize(size);
+            break;
+        case VehiclePropertyType::BYTES:
+            v->byteValues.resize(size);
+            break;
+        default:
+            break;
+    }
+}
+
+}  // namespace
+
 VehiclePropValuePool::RecyclableType VehiclePropValuePool::obtain(VehiclePropertyType type) {
     if (isComplexType(type)) {
         return obtain(type, 0);
@@ -96,19 +126,30 @@ VehiclePropValuePool::RecyclableType VehiclePropValuePool::obtainComplex() {
 
 VehiclePropValuePool::RecyclableType VehiclePropValuePool::obtainRecyclable(
         VehiclePropertyType type, size_t vectorSize) {
-    std::scoped_lock<std::mutex> lock(mLock);
     assert(vectorSize > 0);
 
-    // VehiclePropertyType is not overlapping with vectorSize.
-    int32_t key = static_cast<int32_t>(type) | static_cast<int32_t>(vectorSize);
-    auto it = mValueTypePools.find(key);
-
-    if (it == mValueTypePools.end()) {
-        auto newPool(std::make_unique<InternalPool>(type, vectorSize, mMaxPoolObjectsSize,
-                                                    getVehiclePropValueSize));
-        it = mValueTypePools.emplace(key, std::move(newPool)).first;
+    size_t bucketSize = vectorSizeToBucketSize(vectorSize);
+    RecyclableType value;
+    {
+        std::scoped_lock<std::mutex> lock(mLock);
+
+        // VehiclePropertyType is not overlapping with bucketSize.
+        int32_t key = static_cast<int32_t>(type) | static_cast<int32_t>(bucketSize);
+        auto it = mValueTypePools.find(key);
+
+        if (it == mValueTypePools.end()) {
+            auto newPool(std::make_unique<InternalPool>(type, bucketSize, mMaxPoolObjectsSize,
+                                                        getVehiclePropValueSize));
+            it = mValueTypePools.emplace(key, std::move(newPool)).first;
+        }
+        value = it->second->obtain();
     }
-    return it->second->obtain();
+    if (bucketSize != vectorSize) {
+        // Shrink the bucket-sized payload to the requested length, the capacity is kept for
+        // recycling.
+        resizeRawValueVector(&value->value, type, vectorSize);
+    }
+    return value;
 }
 
 VehiclePropValuePool::RecyclableType VehiclePropValuePool::obtainBoolean(bool value) {
@@ -121,12 +162,20 @@ VehiclePropValuePool::RecyclableType VehiclePropValuePool::obtainDisposable(
                           mDisposableDeleter};
 }
 
+void VehiclePropValuePool::InternalPool::restorePayloadSize(RawPropValues* v) {
+    size_t vectorSize = getVehicleRawValueVectorSize(*v, mPropType);
+    if (vectorSize < mVectorSize) {
+        resizeRawValueVector(v, mPropType, mVectorSize);
+    }
+}
+
 void VehiclePropValuePool::InternalPool::recycle(VehiclePropValue* o) {
     if (o == nullptr) {
         ALOGE("Attempt to recycle nullptr");
         return;
     }
 
+    restorePayloadSize(&o->value);
     if (!check(&o->value)) {
         ALOGE("Discarding value for prop 0x%x because it contains "
               "data that is not consistent with this pool. "
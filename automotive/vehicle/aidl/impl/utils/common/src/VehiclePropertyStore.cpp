@@ -26,6 +26,7 @@
 #include <math/HashCombine.h>
 
 #include <inttypes.h>
+#include <optional>
 
 namespace android {
 namespace hardware {
@@ -56,28 +57,41 @@ size_t VehiclePropertyStore::RecordIdHash::operator()(RecordId const& recordId)
 }
 
 VehiclePropertyStore::~VehiclePropertyStore() {
-    std::scoped_lock<std::mutex> lockGuard(mLock);
-
     // Recycling record requires mValuePool, so need to recycle them before destroying mValuePool.
-    mRecordsByPropId.clear();
+    for (Shard& shard : mShards) {
+        std::scoped_lock<std::mutex> lockGuard(shard.lock);
+        shard.recordsByPropId.clear();
+    }
     mValuePool.reset();
 }
 
-const VehiclePropertyStore::Record* VehiclePropertyStore::getRecordLocked(int32_t propId) const
-        REQUIRES(mLock) {
-    auto RecordIt = mRecordsByPropId.find(propId);
-    return RecordIt == mRecordsByPropId.end() ? nullptr : &RecordIt->second;
+size_t VehiclePropertyStore::shardIndexForProp(int32_t propId) {
+    // Property IDs share high bits (group, area type, value type), the low bits carry the unique
+    // ID, so use them directly to spread properties across shards.
+    return static_cast<size_t>(static_cast<uint32_t>(propId)) % SHARD_COUNT;
+}
+
+const VehiclePropertyStore::Shard& VehiclePropertyStore::shardForProp(int32_t propId) const {
+    return mShards[shardIndexForProp(propId)];
+}
+
+VehiclePropertyStore::Shard& VehiclePropertyStore::shardForProp(int32_t propId) {
+    return mShards[shardIndexForProp(propId)];
 }
 
-VehiclePropertyStore::Record* VehiclePropertyStore::getRecordLocked(int32_t propId)
-        REQUIRES(mLock) {
-    auto RecordIt = mRecordsByPropId.find(propId);
-    return RecordIt == mRecordsByPropId.end() ? nullptr : &RecordIt->second;
+const VehiclePropertyStore::Record* VehiclePropertyStore::getRecordLocked(const Shard& shard,
+                                                                          int32_t propId) {
+    auto RecordIt = shard.recordsByPropId.find(propId);
+    return RecordIt == shard.recordsByPropId.end() ? nullptr : &RecordIt->second;
+}
+
+VehiclePropertyStore::Record* VehiclePropertyStore::getRecordLocked(Shard& shard, int32_t propId) {
+    auto RecordIt = shard.recordsByPropId.find(propId);
+    return RecordIt == shard.recordsByPropId.end() ? nullptr : &RecordIt->second;
 }
 
 VehiclePropertyStore::RecordId VehiclePropertyStore::getRecordIdLocked(
-        const VehiclePropValue& propValue, const VehiclePropertyStore::Record& record) const
-        REQUIRES(mLock) {
+        const VehiclePropValue& propValue, const VehiclePropertyStore::Record& record) const {
     VehiclePropertyStore::RecordId recId{
             .area = isGlobalProp(propValue.prop) ? 0 : propValue.areaId, .token = 0};
 
@@ -88,7 +102,7 @@ VehiclePropertyStore::RecordId VehiclePropertyStore::getRecordIdLocked(
 }
 
 VhalResult<VehiclePropValuePool::RecyclableType> VehiclePropertyStore::readValueLocked(
-        const RecordId& recId, const Record& record) const REQUIRES(mLock) {
+        const RecordId& recId, const Record& record) const {
     if (auto it = record.values.find(recId); it != record.values.end()) {
         return mValuePool->obtain(*(it->second));
     }
@@ -98,9 +112,10 @@ VhalResult<VehiclePropValuePool::RecyclableType> VehiclePropertyStore::readValue
 
 void VehiclePropertyStore::registerProperty(const VehiclePropConfig& config,
                                             VehiclePropertyStore::TokenFunction tokenFunc) {
-    std::scoped_lock<std::mutex> g(mLock);
+    Shard& shard = shardForProp(config.prop);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    mRecordsByPropId[config.prop] = Record{
+    shard.recordsByPropId[config.prop] = Record{
             .propConfig = config,
             .tokenFunction = tokenFunc,
     };
@@ -112,12 +127,11 @@ VhalResult<void> VehiclePropertyStore::writeValue(VehiclePropValuePool::Recyclab
                                                   bool useCurrentTimestamp) {
     bool valueUpdated = true;
     VehiclePropValue updatedValue;
-    OnValueChangeCallback onValueChangeCallback = nullptr;
-    OnValuesChangeCallback onValuesChangeCallback = nullptr;
     int32_t propId;
     int32_t areaId;
     {
-        std::scoped_lock<std::mutex> g(mLock);
+        Shard& shard = shardForProp(propValue->prop);
+        std::scoped_lock<std::mutex> g(shard.lock);
 
         // Must set timestamp inside the lock to make sure no other writeValue will update the
         // the timestamp to a newer one while we are writing this value.
@@ -128,7 +142,7 @@ VhalResult<void> VehiclePropertyStore::writeValue(VehiclePropValuePool::Recyclab
         propId = propValue->prop;
         areaId = propValue->areaId;
 
-        VehiclePropertyStore::Record* record = getRecordLocked(propId);
+        VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
         if (record == nullptr) {
             return StatusError(StatusCode::INVALID_ARG)
                    << "property: " << propId << " not registered";
@@ -166,7 +180,12 @@ VhalResult<void> VehiclePropertyStore::writeValue(VehiclePropValuePool::Recyclab
             return {};
         }
         updatedValue = *(record->values[recId]);
+    }
 
+    OnValueChangeCallback onValueChangeCallback = nullptr;
+    OnValuesChangeCallback onValuesChangeCallback = nullptr;
+    {
+        std::scoped_lock<std::mutex> g(mCallbackLock);
         onValuesChangeCallback = mOnValuesChangeCallback;
         onValueChangeCallback = mOnValueChangeCallback;
     }
@@ -203,15 +222,29 @@ void VehiclePropertyStore::refreshTimestamps(
     OnValuesChangeCallback onValuesChangeCallback = nullptr;
     OnValueChangeCallback onValueChangeCallback = nullptr;
     {
-        std::scoped_lock<std::mutex> g(mLock);
-
+        std::scoped_lock<std::mutex> g(mCallbackLock);
         onValuesChangeCallback = mOnValuesChangeCallback;
         onValueChangeCallback = mOnValueChangeCallback;
+    }
 
-        for (const auto& [propIdAreaId, eventMode] : eventModeByPropIdAreaId) {
+    // Group the requests by shard so each shard lock is only acquired once.
+    std::array<std::vector<std::pair<PropIdAreaId, EventMode>>, SHARD_COUNT> requestsByShard;
+    for (const auto& [propIdAreaId, eventMode] : eventModeByPropIdAreaId) {
+        requestsByShard[shardIndexForProp(propIdAreaId.propId)].emplace_back(propIdAreaId,
+                                                                             eventMode);
+    }
+
+    for (size_t shardIndex = 0; shardIndex < SHARD_COUNT; shardIndex++) {
+        if (requestsByShard[shardIndex].empty()) {
+            continue;
+        }
+        Shard& shard = mShards[shardIndex];
+        std::scoped_lock<std::mutex> g(shard.lock);
+
+        for (const auto& [propIdAreaId, eventMode] : requestsByShard[shardIndex]) {
             int32_t propId = propIdAreaId.propId;
             int32_t areaId = propIdAreaId.areaId;
-            VehiclePropertyStore::Record* record = getRecordLocked(propId);
+            VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
             if (record == nullptr) {
                 continue;
             }
@@ -258,9 +291,10 @@ void VehiclePropertyStore::refreshTimestamps(
 }
 
 void VehiclePropertyStore::removeValue(const VehiclePropValue& propValue) {
-    std::scoped_lock<std::mutex> g(mLock);
+    Shard& shard = shardForProp(propValue.prop);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    VehiclePropertyStore::Record* record = getRecordLocked(propValue.prop);
+    VehiclePropertyStore::Record* record = getRecordLocked(shard, propValue.prop);
     if (record == nullptr) {
         return;
     }
@@ -272,9 +306,10 @@ void VehiclePropertyStore::removeValue(const VehiclePropValue& propValue) {
 }
 
 void VehiclePropertyStore::removeValuesForProperty(int32_t propId) {
-    std::scoped_lock<std::mutex> g(mLock);
+    Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return;
     }
@@ -283,13 +318,14 @@ void VehiclePropertyStore::removeValuesForProperty(int32_t propId) {
 }
 
 std::vector<VehiclePropValuePool::RecyclableType> VehiclePropertyStore::readAllValues() const {
-    std::scoped_lock<std::mutex> g(mLock);
-
     std::vector<VehiclePropValuePool::RecyclableType> allValues;
 
-    for (auto const& [_, record] : mRecordsByPropId) {
-        for (auto const& [_, value] : record.values) {
-            allValues.push_back(std::move(mValuePool->obtain(*value)));
+    for (const Shard& shard : mShards) {
+        std::scoped_lock<std::mutex> g(shard.lock);
+        for (auto const& [_, record] : shard.recordsByPropId) {
+            for (auto const& [_, value] : record.values) {
+                allValues.push_back(std::move(mValuePool->obtain(*value)));
+            }
         }
     }
 
@@ -298,11 +334,12 @@ std::vector<VehiclePropValuePool::RecyclableType> VehiclePropertyStore::readAllV
 
 VehiclePropertyStore::ValuesResultType VehiclePropertyStore::readValuesForProperty(
         int32_t propId) const {
-    std::scoped_lock<std::mutex> g(mLock);
+    const Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
     std::vector<VehiclePropValuePool::RecyclableType> values;
 
-    const VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    const VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return StatusError(StatusCode::INVALID_ARG) << "property: " << propId << " not registered";
     }
@@ -315,10 +352,11 @@ VehiclePropertyStore::ValuesResultType VehiclePropertyStore::readValuesForProper
 
 VehiclePropertyStore::ValueResultType VehiclePropertyStore::readValue(
         const VehiclePropValue& propValue) const {
-    std::scoped_lock<std::mutex> g(mLock);
-
     int32_t propId = propValue.prop;
-    const VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    const Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
+
+    const VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return StatusError(StatusCode::INVALID_ARG) << "property: " << propId << " not registered";
     }
@@ -330,9 +368,10 @@ VehiclePropertyStore::ValueResultType VehiclePropertyStore::readValue(
 VehiclePropertyStore::ValueResultType VehiclePropertyStore::readValue(int32_t propId,
                                                                       int32_t areaId,
                                                                       int64_t token) const {
-    std::scoped_lock<std::mutex> g(mLock);
+    const Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    const VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    const VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return StatusError(StatusCode::INVALID_ARG) << "property: " << propId << " not registered";
     }
@@ -341,21 +380,61 @@ VehiclePropertyStore::ValueResultType VehiclePropertyStore::readValue(int32_t pr
     return readValueLocked(recId, *record);
 }
 
-std::vector<VehiclePropConfig> VehiclePropertyStore::getAllConfigs() const {
-    std::scoped_lock<std::mutex> g(mLock);
+std::vector<VehiclePropertyStore::ValueResultType> VehiclePropertyStore::readValuesBatch(
+        const std::vector<VehiclePropValue>& requests) const {
+    // Group the request indexes by shard so each shard lock is only acquired once per batch.
+    std::array<std::vector<size_t>, SHARD_COUNT> requestIndexesByShard;
+    for (size_t i = 0; i < requests.size(); i++) {
+        requestIndexesByShard[shardIndexForProp(requests[i].prop)].push_back(i);
+    }
+
+    std::vector<std::optional<ValueResultType>> resultsByIndex(requests.size());
+    for (size_t shardIndex = 0; shardIndex < SHARD_COUNT; shardIndex++) {
+        if (requestIndexesByShard[shardIndex].empty()) {
+            continue;
+        }
+        const Shard& shard = mShards[shardIndex];
+        std::scoped_lock<std::mutex> g(shard.lock);
+
+        for (size_t i : requestIndexesByShard[shardIndex]) {
+            const VehiclePropValue& request = requests[i];
+            const VehiclePropertyStore::Record* record = getRecordLocked(shard, request.prop);
+            if (record == nullptr) {
+                resultsByIndex[i] = StatusError(StatusCode::INVALID_ARG)
+                                    << "property: " << request.prop << " not registered";
+                continue;
+            }
+
+            VehiclePropertyStore::RecordId recId = getRecordIdLocked(request, *record);
+            resultsByIndex[i] = readValueLocked(recId, *record);
+        }
+    }
+
+    std::vector<ValueResultType> results;
+    results.reserve(requests.size());
+    for (auto& result : resultsByIndex) {
+        results.push_back(std::move(*result));
+    }
+    return results;
+}
 
+std::vector<VehiclePropConfig> VehiclePropertyStore::getAllConfigs() const {
     std::vector<VehiclePropConfig> configs;
-    configs.reserve(mRecordsByPropId.size());
-    for (auto& [_, config] : mRecordsByPropId) {
-        configs.push_back(config.propConfig);
+
+    for (const Shard& shard : mShards) {
+        std::scoped_lock<std::mutex> g(shard.lock);
+        for (auto& [_, config] : shard.recordsByPropId) {
+            configs.push_back(config.propConfig);
+        }
     }
     return configs;
 }
 
 VhalResult<const VehiclePropConfig*> VehiclePropertyStore::getConfig(int32_t propId) const {
-    std::scoped_lock<std::mutex> g(mLock);
+    const Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    const VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    const VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return StatusError(StatusCode::INVALID_ARG) << "property: " << propId << " not registered";
     }
@@ -364,9 +443,10 @@ VhalResult<const VehiclePropConfig*> VehiclePropertyStore::getConfig(int32_t pro
 }
 
 VhalResult<VehiclePropConfig> VehiclePropertyStore::getPropConfig(int32_t propId) const {
-    std::scoped_lock<std::mutex> g(mLock);
+    const Shard& shard = shardForProp(propId);
+    std::scoped_lock<std::mutex> g(shard.lock);
 
-    const VehiclePropertyStore::Record* record = getRecordLocked(propId);
+    const VehiclePropertyStore::Record* record = getRecordLocked(shard, propId);
     if (record == nullptr) {
         return StatusError(StatusCode::INVALID_ARG) << "property: " << propId << " not registered";
     }
@@ -376,14 +456,14 @@ VhalResult<VehiclePropConfig> VehiclePropertyStore::getPropConfig(int32_t propId
 
 void VehiclePropertyStore::setOnValueChangeCallback(
         const VehiclePropertyStore::OnValueChangeCallback& callback) {
-    std::scoped_lock<std::mutex> g(mLock);
+    std::scoped_lock<std::mutex> g(mCallbackLock);
 
     mOnValueChangeCallback = callback;
 }
 
 void VehiclePropertyStore::setOnValuesChangeCallback(
         const VehiclePropertyStore::OnValuesChangeCallback& callback) {
-    std::scoped_lock<std::mutex> g(mLock);
+    std::scoped_lock<std::mutex> g(mCallbackLock);
 
     mOnValuesChangeCallback = callback;
 }
@@ -60,14 +60,14 @@ class RecurrentTimerTest : public testing::Test {
         mCallbacks.clear();
     }
 
-    size_t countCallbackInfoById(RecurrentTimer* timer) {
+    size_t countIntervalBuckets(RecurrentTimer* timer) {
         std::scoped_lock<std::mutex> lockGuard(timer->mLock);
-        return timer->mCallbackInfoById.size();
+        return timer->mBucketById.size();
     }
 
-    size_t countIdByCallback(RecurrentTimer* timer) {
+    size_t countRegisteredCallbacks(RecurrentTimer* timer) {
         std::scoped_lock<std::mutex> lockGuard(timer->mLock);
-        return timer->mIdByCallback.size();
+        return timer->mIntervalByCallback.size();
     }
 
   private:
@@ -115,8 +115,8 @@ TEST_F(RecurrentTimerTest, testRegisterUnregisterRegister) {
 
     timer.unregisterTimerCallback(action);
 
-    ASSERT_EQ(countCallbackInfoById(&timer), 0u);
-    ASSERT_EQ(countIdByCallback(&timer), 0u);
+    ASSERT_EQ(countIntervalBuckets(&timer), 0u);
+    ASSERT_EQ(countRegisteredCallbacks(&timer), 0u);
 }
 
 TEST_F(RecurrentTimerTest, testDestroyTimerWithCallback) {
@@ -185,6 +185,37 @@ TEST_F(RecurrentTimerTest, testRegisterMultipleCallbacks) {
     ASSERT_GE(action3Count, static_cast<size_t>(33));
 }
 
+TEST_F(RecurrentTimerTest, testCallbacksWithSameIntervalShareOneBucket) {
+    RecurrentTimer timer;
+    // 0.1s
+    int64_t interval = 100'000'000;
+
+    auto action1 = getCallback(1);
+    auto action2 = getCallback(2);
+    auto action3 = getCallback(3);
+    timer.registerTimerCallback(interval, action1);
+    timer.registerTimerCallback(interval, action2);
+    timer.registerTimerCallback(interval, action3);
+
+    // All three callbacks share the same interval so they must be coalesced into one bucket
+    // (one timer wakeup per tick).
+    ASSERT_EQ(countIntervalBuckets(&timer), 1u);
+    ASSERT_EQ(countRegisteredCallbacks(&timer), 3u);
+
+    // In 1s, each action should be called about 10 times.
+    ASSERT_TRUE(waitForCalledCallbacks(/* count= */ 30u, /* timeoutInMs= */ 5000))
+            << "Not enough callbacks called before timeout";
+
+    timer.unregisterTimerCallback(action1);
+    timer.unregisterTimerCallback(action2);
+    // The bucket must stay alive while it still has one callback.
+    ASSERT_EQ(countIntervalBuckets(&timer), 1u);
+
+    timer.unregisterTimerCallback(action3);
+    ASSERT_EQ(countIntervalBuckets(&timer), 0u);
+    ASSERT_EQ(countRegisteredCallbacks(&timer), 0u);
+}
+
 TEST_F(RecurrentTimerTest, testRegisterSameCallbackMultipleTimes) {
     RecurrentTimer timer;
     // 0.2s
@@ -206,8 +237,8 @@ TEST_F(RecurrentTimerTest, testRegisterSameCallbackMultipleTimes) {
 
     timer.unregisterTimerCallback(action);
 
-    ASSERT_EQ(countCallbackInfoById(&timer), 0u);
-    ASSERT_EQ(countIdByCallback(&timer), 0u);
+    ASSERT_EQ(countIntervalBuckets(&timer), 0u);
+    ASSERT_EQ(countRegisteredCallbacks(&timer), 0u);
 }
 
 TEST_F(RecurrentTimerTest, testRegisterCallbackMultipleTimesNoDeadLock) {
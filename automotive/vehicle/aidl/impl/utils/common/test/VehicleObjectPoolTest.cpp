@@ -79,23 +79,24 @@ std::vector<TestPropertyTypeInfo> getAllPropertyTypes() {
                     .vecSize = 4,
             },
             {
+                    // Larger than maxRecyclableVectorSize, recycled via a size-bucketed pool.
                     .type = VehiclePropertyType::INT32_VEC,
-                    .recyclable = false,
+                    .recyclable = true,
                     .vecSize = 5,
             },
             {
                     .type = VehiclePropertyType::INT64_VEC,
-                    .recyclable = false,
+                    .recyclable = true,
                     .vecSize = 5,
             },
             {
                     .type = VehiclePropertyType::FLOAT_VEC,
-                    .recyclable = false,
+                    .recyclable = true,
                     .vecSize = 5,
             },
             {
                     .type = VehiclePropertyType::BYTES,
-                    .recyclable = false,
+                    .recyclable = true,
                     .vecSize = 5,
             },
             {
@@ -375,6 +376,35 @@ TEST_F(VehicleObjectPoolTest, testMultithreaded) {
     ASSERT_LE(mStats->Created, static_cast<uint32_t>(T * O));
 }
 
+TEST_F(VehicleObjectPoolTest, testLargeVectorsShareSizeBucket) {
+    // 5, 6 and 8 elements all round up to the same power-of-two bucket (8), so they must be
+    // served by the same pool.
+    auto value = mValuePool->obtain(VehiclePropertyType::INT32_VEC, 5);
+    ASSERT_EQ(value->value.int32Values.size(), 5u);
+    void* raw = value.get();
+    value.reset();
+
+    auto value2 = mValuePool->obtain(VehiclePropertyType::INT32_VEC, 6);
+    ASSERT_EQ(value2.get(), raw);
+    ASSERT_EQ(value2->value.int32Values.size(), 6u);
+    value2.reset();
+
+    auto value3 = mValuePool->obtain(VehiclePropertyType::INT32_VEC, 8);
+    ASSERT_EQ(value3.get(), raw);
+    ASSERT_EQ(value3->value.int32Values.size(), 8u);
+    value3.reset();
+
+    ASSERT_EQ(mStats->Obtained, 3u);
+    ASSERT_EQ(mStats->Created, 1u);
+}
+
+TEST_F(VehicleObjectPoolTest, testVeryLargeVectorNotRecyclable) {
+    auto value = mValuePool->obtain(VehiclePropertyType::BYTES, 100000);
+
+    ASSERT_EQ(value->value.byteValues.size(), 100000u);
+    ASSERT_EQ(mStats->Obtained, 0u) << "Oversized vectors should not be served from the pool";
+}
+
 TEST_F(VehicleObjectPoolTest, testMemoryLimitation) {
     std::vector<recyclable_ptr<VehiclePropValue>> vec;
     for (size_t i = 0; i < 10000; i++) {
@@ -215,6 +215,41 @@ TEST_F(VehiclePropertyStoreTest, testReadValueByPropIdOk) {
     ASSERT_EQ(*(result.value()), values[2]);
 }
 
+TEST_F(VehiclePropertyStoreTest, testReadValuesBatch) {
+    auto values = getTestPropValues();
+    for (const auto& value : values) {
+        ASSERT_RESULT_OK(mStore->writeValue(mValuePool->obtain(value)));
+    }
+
+    VehiclePropValue unavailableRequest = {
+            .prop = toInt(VehicleProperty::TIRE_PRESSURE),
+            .areaId = WHEEL_REAR_LEFT,
+    };
+    VehiclePropValue invalidRequest = {
+            .prop = INVALID_PROP_ID,
+    };
+    std::vector<VehiclePropValue> requests = {values[1], values[0], unavailableRequest,
+                                              invalidRequest, values[2]};
+
+    auto results = mStore->readValuesBatch(requests);
+
+    ASSERT_EQ(results.size(), requests.size());
+    ASSERT_RESULT_OK(results[0]);
+    EXPECT_EQ(*(results[0].value()), values[1]);
+    ASSERT_RESULT_OK(results[1]);
+    EXPECT_EQ(*(results[1].value()), values[0]);
+    EXPECT_FALSE(results[2].ok()) << "expect error for a value that has not been written";
+    EXPECT_EQ(results[2].error().code(), StatusCode::NOT_AVAILABLE);
+    EXPECT_FALSE(results[3].ok()) << "expect error for an invalid property ID";
+    EXPECT_EQ(results[3].error().code(), StatusCode::INVALID_ARG);
+    ASSERT_RESULT_OK(results[4]);
+    EXPECT_EQ(*(results[4].value()), values[2]);
+}
+
+TEST_F(VehiclePropertyStoreTest, testReadValuesBatchEmpty) {
+    ASSERT_TRUE(mStore->readValuesBatch({}).empty());
+}
+
 TEST_F(VehiclePropertyStoreTest, testReadValueError) {
     auto values = getTestPropValues();
     for (const auto& value : values) {
@@ -22,6 +22,8 @@
 
 #include <atomic>
 #include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace android {
@@ -751,6 +753,111 @@ TEST(VehicleUtilsTest, testConcurrentQueuePushAfterDeactivate) {
     ASSERT_TRUE(queue.flush().empty());
 }
 
+TEST(VehicleUtilsTest, testConcurrentQueueRingOneThread) {
+    ConcurrentQueue<int> queue(/*ringCapacity=*/4);
+
+    queue.push(1);
+    queue.push(2);
+    auto result = queue.flush();
+
+    ASSERT_EQ(result, std::vector<int>({1, 2}));
+}
+
+TEST(VehicleUtilsTest, testConcurrentQueueRingOverflowKeepsFifoOrder) {
+    // Capacity is rounded up to 4, push more than the ring can hold so the overflow path is
+    // exercised.
+    ConcurrentQueue<int> queue(/*ringCapacity=*/3);
+
+    for (int i = 0; i < 10; i++) {
+        queue.push(std::move(i));
+    }
+    auto result = queue.flush();
+
+    ASSERT_EQ(result, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(VehicleUtilsTest, testConcurrentQueueRingProducerConsumer) {
+    ConcurrentQueue<int> queue(/*ringCapacity=*/16);
+    std::vector<int> results;
+    std::atomic<bool> stop = false;
+
+    std::thread producer([&queue]() {
+        for (int i = 0; i < 10000; i++) {
+            queue.push(std::move(i));
+        }
+    });
+    std::thread consumer([&queue, &results, &stop]() {
+        while (!stop) {
+            queue.waitForItems();
+            for (int i : queue.flush()) {
+                results.push_back(i);
+            }
+        }
+
+        // After we stop, get all the remaining values in the queue.
+        for (int i : queue.flush()) {
+            results.push_back(i);
+        }
+    });
+
+    producer.join();
+
+    stop = true;
+    queue.deactivate();
+    consumer.join();
+
+    ASSERT_EQ(results.size(), static_cast<size_t>(10000));
+    // A single producer must observe its pushes in order.
+    for (int i = 0; i < 10000; i++) {
+        ASSERT_EQ(results[i], i);
+    }
+}
+
+TEST(VehicleUtilsTest, testConcurrentQueueRingMultipleProducers) {
+    // Small ring so the overflow path is exercised while multiple producers are pushing.
+    ConcurrentQueue<std::pair<int, int>> queue(/*ringCapacity=*/16);
+    std::vector<std::pair<int, int>> results;
+    std::atomic<bool> stop = false;
+
+    std::vector<std::thread> producers;
+    for (int producerId = 0; producerId < 4; producerId++) {
+        producers.emplace_back([&queue, producerId]() {
+            for (int i = 0; i < 1000; i++) {
+                queue.push(std::make_pair(producerId, i));
+            }
+        });
+    }
+    std::thread consumer([&queue, &results, &stop]() {
+        while (!stop) {
+            queue.waitForItems();
+            for (auto& item : queue.flush()) {
+                results.push_back(item);
+            }
+        }
+
+        // After we stop, get all the remaining values in the queue.
+        for (auto& item : queue.flush()) {
+            results.push_back(item);
+        }
+    });
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    stop = true;
+    queue.deactivate();
+    consumer.join();
+
+    ASSERT_EQ(results.size(), static_cast<size_t>(4000));
+    // Each producer must observe its own pushes in order.
+    std::unordered_map<int, int> nextPerProducer;
+    for (const auto& [producerId, value] : results) {
+        EXPECT_EQ(value, nextPerProducer[producerId]);
+        nextPerProducer[producerId]++;
+    }
+}
+
 TEST(VehicleUtilsTest, testConcurrentQueueDeactivateNotifyWaitingThread) {
     ConcurrentQueue<int> queue;
 
@@ -110,6 +110,13 @@ class SubscriptionClient {
             CallbackType callback,
             std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropValue>&&
                     updatedValues);
+    // Same as above, but marshals the updated values only once and sends the same parcelable to
+    // every callback. For a large batch that is backed by a shared memory file, the file is
+    // created once and duplicated per transaction instead of being re-serialized per client.
+    static void sendUpdatedValues(
+            const std::vector<CallbackType>& callbacks,
+            std::vector<aidl::android::hardware::automotive::vehicle::VehiclePropValue>&&
+                    updatedValues);
     // Marshals the set property error events into largeParcelable and sends it through
     // {@code onPropertySetError} callback.
     static void sendPropertySetErrors(
@@ -31,9 +31,13 @@
 #include <android-base/thread_annotations.h>
 #include <android/binder_auto_utils.h>
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -121,6 +125,55 @@ class DefaultVehicleHal final : public aidlvhal::BnVehicle {
     static constexpr int64_t TIMEOUT_IN_NANO = 30'000'000'000;
     // heart beat event interval: 3s
     static constexpr int64_t HEART_BEAT_INTERVAL_IN_NANO = 3'000'000'000;
+    // Lightweight hot-path latency histogram surfaced through dump(). Recording costs two
+    // clock reads and one relaxed atomic increment per call, cheap enough to stay always-on
+    // for fleet triage without perfetto.
+    struct LatencyHistogram {
+        // Bucket upper bounds in milliseconds; the last bucket is unbounded.
+        static constexpr int64_t BUCKET_BOUNDS_MS[] = {1, 5, 10, 50, 100};
+        static constexpr size_t NUM_BUCKETS = 6;
+        std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+
+        void record(int64_t durationNs) {
+            int64_t durationMs = durationNs / 1'000'000;
+            size_t bucket = NUM_BUCKETS - 1;
+            for (size_t i = 0; i < NUM_BUCKETS - 1; i++) {
+                if (durationMs < BUCKET_BOUNDS_MS[i]) {
+                    bucket = i;
+                    break;
+                }
+            }
+            buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+        }
+        std::string dump() const;
+    };
+
+    // Records the enclosing scope's duration into the given histogram on destruction, so all
+    // return paths are covered.
+    class ScopedLatencyRecorder {
+      public:
+        explicit ScopedLatencyRecorder(LatencyHistogram* histogram)
+            : mHistogram(histogram), mStart(std::chrono::steady_clock::now()) {}
+        ~ScopedLatencyRecorder() {
+            mHistogram->record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                       std::chrono::steady_clock::now() - mStart)
+                                       .count());
+        }
+
+      private:
+        LatencyHistogram* mHistogram;
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+    // Request handling time on the binder thread (excluding asynchronous hardware completion).
+    mutable LatencyHistogram mGetValuesLatency;
+    mutable LatencyHistogram mSetValuesLatency;
+
+    // Ring-buffer capacity for the batched property event queue. Property change events are
+    // pushed from multiple hardware threads but the batching consumer is the only reader, so
+    // the queue can use its lock-free MPSC fast path. Sized to absorb one batching window at
+    // high event rates before falling back to the locked overflow queue.
+    static constexpr size_t BATCHED_EVENT_QUEUE_RING_CAPACITY = 4096;
     bool mShouldRefreshPropertyConfigs;
     std::unique_ptr<IVehicleHardware> mVehicleHardware;
 
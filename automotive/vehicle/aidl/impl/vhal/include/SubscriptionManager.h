@@ -110,8 +110,11 @@ class SubscriptionManager final {
     // For a list of updated properties, returns a map that maps clients subscribing to
     // the updated properties to a list of updated values. This would only return on-change property
     // clients that should be informed for the given updated values.
-    std::unordered_map<CallbackType, std::vector<VehiclePropValue>> getSubscribedClients(
-            std::vector<VehiclePropValue>&& updatedValues);
+    // Clients that subscribe to every updated value without any client-specific filtering
+    // (resolution sanitization or client-side VUR) share one value batch, so large updates are
+    // not copied (and later not serialized) once per client.
+    std::unordered_map<CallbackType, std::shared_ptr<std::vector<VehiclePropValue>>>
+    getSubscribedClients(std::vector<VehiclePropValue>&& updatedValues);
 
     // For a list of set property error events, returns a map that maps clients subscribing to the
     // properties to a list of errors for each client.
@@ -252,7 +252,12 @@ template class GetSetValuesClient<SetValueResult, SetValueResults>;
 
 void SubscriptionClient::sendUpdatedValues(std::shared_ptr<IVehicleCallback> callback,
                                            std::vector<VehiclePropValue>&& updatedValues) {
-    if (updatedValues.empty()) {
+    sendUpdatedValues(std::vector<CallbackType>({std::move(callback)}), std::move(updatedValues));
+}
+
+void SubscriptionClient::sendUpdatedValues(const std::vector<CallbackType>& callbacks,
+                                           std::vector<VehiclePropValue>&& updatedValues) {
+    if (updatedValues.empty() || callbacks.empty()) {
         return;
     }
 
@@ -269,13 +274,15 @@ void SubscriptionClient::sendUpdatedValues(std::shared_ptr<IVehicleCallback> cal
         return;
     }
 
-    if (ScopedAStatus callbackStatus =
-                callback->onPropertyEvent(vehiclePropValues, sharedMemoryFileCount);
-        !callbackStatus.isOk()) {
-        ALOGE("subscribe: failed to call onPropertyEvent callback, client ID: %p, error: %s, "
-              "exception: %d, service specific error: %d",
-              callback->asBinder().get(), callbackStatus.getMessage(),
-              callbackStatus.getExceptionCode(), callbackStatus.getServiceSpecificError());
+    for (const auto& callback : callbacks) {
+        if (ScopedAStatus callbackStatus =
+                    callback->onPropertyEvent(vehiclePropValues, sharedMemoryFileCount);
+            !callbackStatus.isOk()) {
+            ALOGE("subscribe: failed to call onPropertyEvent callback, client ID: %p, error: %s, "
+                  "exception: %d, service specific error: %d",
+                  callback->asBinder().get(), callbackStatus.getMessage(),
+                  callbackStatus.getExceptionCode(), callbackStatus.getServiceSpecificError());
+        }
     }
 }
 
@@ -110,7 +110,8 @@ DefaultVehicleHal::DefaultVehicleHal(std::unique_ptr<IVehicleHardware> vehicleHa
     mSubscriptionManager = std::make_shared<SubscriptionManager>(vehicleHardwarePtr);
     mEventBatchingWindow = mVehicleHardware->getPropertyOnChangeEventBatchingWindow();
     if (mEventBatchingWindow != std::chrono::nanoseconds(0)) {
-        mBatchedEventQueue = std::make_shared<ConcurrentQueue<VehiclePropValue>>();
+        mBatchedEventQueue = std::make_shared<ConcurrentQueue<VehiclePropValue>>(
+                BATCHED_EVENT_QUEUE_RING_CAPACITY);
         mPropertyChangeEventsBatchingConsumer =
                 std::make_shared<BatchingConsumer<VehiclePropValue>>();
         mPropertyChangeEventsBatchingConsumer->run(
@@ -207,8 +208,15 @@ void DefaultVehicleHal::onPropertyChangeEvent(
         return;
     }
     auto updatedValuesByClients = manager->getSubscribedClients(std::move(updatedValues));
-    for (auto& [callback, values] : updatedValuesByClients) {
-        SubscriptionClient::sendUpdatedValues(callback, std::move(values));
+    // Group the callbacks that share one batch so the batch is only serialized once (binder
+    // duplicates the shared memory fd per transaction for large batches).
+    std::unordered_map<std::vector<VehiclePropValue>*, std::vector<CallbackType>>
+            callbacksByBatch;
+    for (const auto& [callback, values] : updatedValuesByClients) {
+        callbacksByBatch[values.get()].push_back(callback);
+    }
+    for (auto& [batch, callbacks] : callbacksByBatch) {
+        SubscriptionClient::sendUpdatedValues(callbacks, std::move(*batch));
     }
 }
 
@@ -447,6 +455,7 @@ Result<void> DefaultVehicleHal::checkProperty(const VehiclePropValue& propValue)
 ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
                                            const GetValueRequests& requests) {
     ATRACE_CALL();
+    ScopedLatencyRecorder latencyRecorder(&mGetValuesLatency);
     if (callback == nullptr) {
         return ScopedAStatus::fromExceptionCode(EX_NULL_POINTER);
     }
@@ -467,12 +476,19 @@ ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
 
     // A list of failed result we already know before sending to hardware.
     std::vector<GetValueResult> failedResults;
-    // The list of requests that we would send to hardware.
+    // The list of requests that we would send to hardware. Only populated once a request fails
+    // the permission check; in the common case where the whole batch passes, the deserialized
+    // request list is sent to the hardware as-is without a per-request copy.
     std::vector<GetValueRequest> hardwareRequests;
 
-    for (const auto& request : getValueRequests) {
+    for (size_t i = 0; i < getValueRequests.size(); i++) {
+        const auto& request = getValueRequests[i];
         if (auto result = checkReadPermission(request.prop); !result.ok()) {
             ALOGW("property does not support reading: %s", getErrorMsg(result).c_str());
+            if (failedResults.empty()) {
+                // First failure, all the requests before this one have passed the check.
+                hardwareRequests.assign(getValueRequests.begin(), getValueRequests.begin() + i);
+            }
             failedResults.push_back(GetValueResult{
                     .requestId = request.requestId,
                     .status = getErrorCode(result),
@@ -480,12 +496,17 @@ ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
             });
             continue;
         }
-        hardwareRequests.push_back(request);
+        if (!failedResults.empty()) {
+            hardwareRequests.push_back(request);
+        }
     }
+    const std::vector<GetValueRequest>& requestsToHardware =
+            failedResults.empty() ? getValueRequests : hardwareRequests;
 
     // The set of request Ids that we would send to hardware.
     std::unordered_set<int64_t> hardwareRequestIds;
-    for (const auto& request : hardwareRequests) {
+    hardwareRequestIds.reserve(requestsToHardware.size());
+    for (const auto& request : requestsToHardware) {
         hardwareRequestIds.insert(request.requestId);
     }
 
@@ -513,12 +534,12 @@ ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
         client->sendResults(std::move(failedResults));
     }
 
-    if (hardwareRequests.empty()) {
+    if (requestsToHardware.empty()) {
         return ScopedAStatus::ok();
     }
 
     if (StatusCode status =
-                mVehicleHardware->getValues(client->getResultCallback(), hardwareRequests);
+                mVehicleHardware->getValues(client->getResultCallback(), requestsToHardware);
         status != StatusCode::OK) {
         // If the hardware returns error, finish all the pending requests for this request because
         // we never expect hardware to call callback for these requests.
@@ -534,6 +555,7 @@ ScopedAStatus DefaultVehicleHal::getValues(const CallbackType& callback,
 ScopedAStatus DefaultVehicleHal::setValues(const CallbackType& callback,
                                            const SetValueRequests& requests) {
     ATRACE_CALL();
+    ScopedLatencyRecorder latencyRecorder(&mSetValuesLatency);
     if (callback == nullptr) {
         return ScopedAStatus::fromExceptionCode(EX_NULL_POINTER);
     }
@@ -548,7 +570,9 @@ ScopedAStatus DefaultVehicleHal::setValues(const CallbackType& callback,
 
     // A list of failed result we already know before sending to hardware.
     std::vector<SetValueResult> failedResults;
-    // The list of requests that we would send to hardware.
+    // The list of requests that we would send to hardware. Only populated once a request fails
+    // validation; in the common case where the whole batch passes, the deserialized request
+    // list is sent to the hardware as-is without a per-request copy.
     std::vector<SetValueRequest> hardwareRequests;
 
     auto maybeRequestIds = checkDuplicateRequests(setValueRequests);
@@ -557,32 +581,41 @@ ScopedAStatus DefaultVehicleHal::setValues(const CallbackType& callback,
         return toScopedAStatus(maybeRequestIds, StatusCode::INVALID_ARG);
     }
 
-    for (auto& request : setValueRequests) {
+    for (size_t i = 0; i < setValueRequests.size(); i++) {
+        const auto& request = setValueRequests[i];
         int64_t requestId = request.requestId;
+        StatusCode errorCode = StatusCode::OK;
         if (auto result = checkWritePermission(request.value); !result.ok()) {
             ALOGW("property does not support writing: %s", getErrorMsg(result).c_str());
-            failedResults.push_back(SetValueResult{
-                    .requestId = requestId,
-                    .status = getErrorCode(result),
-            });
-            continue;
-        }
-        if (auto result = checkProperty(request.value); !result.ok()) {
+            errorCode = getErrorCode(result);
+        } else if (auto result = checkProperty(request.value); !result.ok()) {
             ALOGW("setValues[%" PRId64 "]: property is not valid: %s", requestId,
                   getErrorMsg(result).c_str());
+            errorCode = StatusCode::INVALID_ARG;
+        }
+
+        if (errorCode != StatusCode::OK) {
+            if (failedResults.empty()) {
+                // First failure, all the requests before this one have passed validation.
+                hardwareRequests.assign(setValueRequests.begin(), setValueRequests.begin() + i);
+            }
             failedResults.push_back(SetValueResult{
                     .requestId = requestId,
-                    .status = StatusCode::INVALID_ARG,
+                    .status = errorCode,
             });
             continue;
         }
-
-        hardwareRequests.push_back(request);
+        if (!failedResults.empty()) {
+            hardwareRequests.push_back(request);
+        }
     }
+    const std::vector<SetValueRequest>& requestsToHardware =
+            failedResults.empty() ? setValueRequests : hardwareRequests;
 
     // The set of request Ids that we would send to hardware.
     std::unordered_set<int64_t> hardwareRequestIds;
-    for (const auto& request : hardwareRequests) {
+    hardwareRequestIds.reserve(requestsToHardware.size());
+    for (const auto& request : requestsToHardware) {
         hardwareRequestIds.insert(request.requestId);
     }
 
@@ -609,12 +642,12 @@ ScopedAStatus DefaultVehicleHal::setValues(const CallbackType& callback,
         client->sendResults(std::move(failedResults));
     }
 
-    if (hardwareRequests.empty()) {
+    if (requestsToHardware.empty()) {
         return ScopedAStatus::ok();
     }
 
     if (StatusCode status =
-                mVehicleHardware->setValues(client->getResultCallback(), hardwareRequests);
+                mVehicleHardware->setValues(client->getResultCallback(), requestsToHardware);
         status != StatusCode::OK) {
         // If the hardware returns error, finish all the pending requests for this request because
         // we never expect hardware to call callback for these requests.
@@ -950,6 +983,25 @@ bool DefaultVehicleHal::checkDumpPermission() {
     return uid == AID_ROOT || uid == AID_SHELL || uid == AID_SYSTEM;
 }
 
+std::string DefaultVehicleHal::LatencyHistogram::dump() const {
+    std::string result;
+    uint64_t total = 0;
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        total += buckets[i].load(std::memory_order_relaxed);
+    }
+    result += StringPrintf("total: %" PRIu64 ", ", total);
+    for (size_t i = 0; i < NUM_BUCKETS; i++) {
+        if (i < NUM_BUCKETS - 1) {
+            result += StringPrintf("<%" PRId64 "ms: ", BUCKET_BOUNDS_MS[i]);
+        } else {
+            result += StringPrintf(">=%" PRId64 "ms: ", BUCKET_BOUNDS_MS[NUM_BUCKETS - 2]);
+        }
+        result += StringPrintf("%" PRIu64 "%s", buckets[i].load(std::memory_order_relaxed),
+                               i == NUM_BUCKETS - 1 ? "" : ", ");
+    }
+    return result;
+}
+
 binder_status_t DefaultVehicleHal::dump(int fd, const char** args, uint32_t numArgs) {
     if (!checkDumpPermission()) {
         dprintf(fd, "Caller must be root, system or shell");
@@ -974,6 +1026,8 @@ binder_status_t DefaultVehicleHal::dump(int fd, const char** args, uint32_t numA
         return STATUS_OK;
     }
     dprintf(fd, "Vehicle HAL State: \n");
+    dprintf(fd, "  getValues latency: %s\n", mGetValuesLatency.dump().c_str());
+    dprintf(fd, "  setValues latency: %s\n", mSetValuesLatency.dump().c_str());
     const auto& configsByPropId = getConfigsByPropId();
     {
         std::scoped_lock<std::mutex> lockGuard(mLock);
@@ -419,12 +419,24 @@ bool SubscriptionManager::isValueUpdatedLocked(const std::shared_ptr<IVehicleCal
     return true;
 }
 
-std::unordered_map<std::shared_ptr<IVehicleCallback>, std::vector<VehiclePropValue>>
+std::unordered_map<std::shared_ptr<IVehicleCallback>,
+                   std::shared_ptr<std::vector<VehiclePropValue>>>
 SubscriptionManager::getSubscribedClients(std::vector<VehiclePropValue>&& updatedValues) {
     std::scoped_lock<std::mutex> lockGuard(mLock);
-    std::unordered_map<std::shared_ptr<IVehicleCallback>, std::vector<VehiclePropValue>> clients;
-
-    for (auto& value : updatedValues) {
+    std::unordered_map<std::shared_ptr<IVehicleCallback>,
+                       std::shared_ptr<std::vector<VehiclePropValue>>>
+            clients;
+
+    // First pass: for each subscribed client, count the matched values and check whether any of
+    // them must be modified for this specific client. A client that matches every updated value
+    // unmodified can share one batch with all the other such clients instead of getting its own
+    // copy, which matters for large (e.g. camera-calibration or map-data) properties.
+    struct ClientPlan {
+        size_t matchedValueCount = 0;
+        bool needsOwnCopy = false;
+    };
+    std::unordered_map<std::shared_ptr<IVehicleCallback>, ClientPlan> plans;
+    for (const auto& value : updatedValues) {
         PropIdAreaId propIdAreaId{
                 .propId = value.prop,
                 .areaId = value.areaId,
@@ -438,6 +450,34 @@ SubscriptionManager::getSubscribedClients(std::vector<VehiclePropValue>&& update
             // returning an empty ContSubConfigs value for subConfigs i.e. with resolution = 0 and
             // enableVur = false.
             auto& subConfigs = mContSubConfigsByPropIdArea[propIdAreaId];
+            auto& plan = plans[callback];
+            plan.matchedValueCount++;
+            // Clients with a requested resolution get a sanitized copy, clients with client-side
+            // VUR filtering may not receive every value.
+            if (subConfigs.getResolutionForClient(client) != 0 ||
+                (subConfigs.isVurEnabledForClient(client) && !subConfigs.isVurEnabled())) {
+                plan.needsOwnCopy = true;
+            }
+        }
+    }
+
+    // Second pass: build the per-client batches for the clients that need their own copy.
+    for (auto& value : updatedValues) {
+        PropIdAreaId propIdAreaId{
+                .propId = value.prop,
+                .areaId = value.areaId,
+        };
+        if (mClientsByPropIdAreaId.find(propIdAreaId) == mClientsByPropIdAreaId.end()) {
+            continue;
+        }
+
+        for (const auto& [client, callback] : mClientsByPropIdAreaId[propIdAreaId]) {
+            const auto& plan = plans[callback];
+            if (!plan.needsOwnCopy && plan.matchedValueCount == updatedValues.size()) {
+                // This client receives the shared full batch.
+                continue;
+            }
+            auto& subConfigs = mContSubConfigsByPropIdArea[propIdAreaId];
             // Clients must be sent different VehiclePropValues with different levels of granularity
             // as requested by the client using resolution.
             VehiclePropValue newValue = value;
@@ -446,13 +486,28 @@ SubscriptionManager::getSubscribedClients(std::vector<VehiclePropValue>&& update
             // possible that VUR is not enabled in IVehicleHardware because another client does not
             // enable VUR. We will implement VUR filtering here for the client that enables it.
             if (subConfigs.isVurEnabledForClient(client) && !subConfigs.isVurEnabled()) {
-                if (isValueUpdatedLocked(callback, newValue)) {
-                    clients[callback].push_back(newValue);
+                if (!isValueUpdatedLocked(callback, newValue)) {
+                    continue;
                 }
-            } else {
-                clients[callback].push_back(newValue);
             }
+            auto& clientValues = clients[callback];
+            if (clientValues == nullptr) {
+                clientValues = std::make_shared<std::vector<VehiclePropValue>>();
+            }
+            clientValues->push_back(std::move(newValue));
+        }
+    }
+
+    // All the full-batch clients share one batch built from the updated values.
+    std::shared_ptr<std::vector<VehiclePropValue>> fullBatch;
+    for (const auto& [callback, plan] : plans) {
+        if (plan.needsOwnCopy || plan.matchedValueCount != updatedValues.size()) {
+            continue;
+        }
+        if (fullBatch == nullptr) {
+            fullBatch = std::make_shared<std::vector<VehiclePropValue>>(std::move(updatedValues));
         }
+        clients[callback] = fullBatch;
     }
     return clients;
 }
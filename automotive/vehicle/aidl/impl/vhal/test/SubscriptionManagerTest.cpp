@@ -412,9 +412,9 @@ TEST_F(SubscriptionManagerTest, testSubscribeOnchange) {
     };
     auto clients = getManager()->getSubscribedClients(std::vector<VehiclePropValue>(updatedValues));
 
-    ASSERT_THAT(clients[client1],
+    ASSERT_THAT(*clients[client1],
                 UnorderedElementsAre(updatedValues[0], updatedValues[1], updatedValues[2]));
-    ASSERT_THAT(clients[client2], ElementsAre(updatedValues[0]));
+    ASSERT_THAT(*clients[client2], ElementsAre(updatedValues[0]));
 }
 
 TEST_F(SubscriptionManagerTest, testSubscribeInvalidOption) {
@@ -503,7 +503,7 @@ TEST_F(SubscriptionManagerTest, testUnsubscribeOnchange) {
     };
     auto clients = getManager()->getSubscribedClients(std::vector<VehiclePropValue>(updatedValues));
 
-    ASSERT_THAT(clients[getCallbackClient()], ElementsAre(updatedValues[1]));
+    ASSERT_THAT(*clients[getCallbackClient()], ElementsAre(updatedValues[1]));
     ASSERT_THAT(getHardware()->getSubscribedOnChangePropIdAreaIds(),
                 UnorderedElementsAre(std::pair<int32_t, int32_t>(1, 0)));
 }
@@ -633,8 +633,8 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_filterUnchangedEvents) {
     auto clients =
             getManager()->getSubscribedClients(std::vector<VehiclePropValue>(propertyEvents));
 
-    ASSERT_THAT(clients[client1], UnorderedElementsAre(propertyEvents[0]));
-    ASSERT_THAT(clients[client2], UnorderedElementsAre(propertyEvents[0], propertyEvents[1]));
+    ASSERT_THAT(*clients[client1], UnorderedElementsAre(propertyEvents[0]));
+    ASSERT_THAT(*clients[client2], UnorderedElementsAre(propertyEvents[0], propertyEvents[1]));
 
     // If the same property events happen again with a new timestamp.
     // VUR is disabled for client1, enabled for client2.
@@ -713,8 +713,8 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_filterUnchangedEvents_wi
     auto clients =
             getManager()->getSubscribedClients(std::vector<VehiclePropValue>(propertyEvents));
 
-    ASSERT_THAT(clients[client1], UnorderedElementsAre(propertyEvents[0]));
-    ASSERT_THAT(clients[client2], UnorderedElementsAre(propertyEvents[0], propertyEvents[1]));
+    ASSERT_THAT(*clients[client1], UnorderedElementsAre(propertyEvents[0]));
+    ASSERT_THAT(*clients[client2], UnorderedElementsAre(propertyEvents[0], propertyEvents[1]));
 
     clients = getManager()->getSubscribedClients({{
             .prop = 0,
@@ -727,9 +727,9 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_filterUnchangedEvents_wi
             << "Must not filter out property events if VUR is not enabled";
     ASSERT_TRUE(clients.find(client2) == clients.end())
             << "Must filter out property events if VUR is enabled and change is too small";
-    ASSERT_TRUE(abs(clients[client1][0].value.floatValues[0] - 1.01) < 0.0000001)
+    ASSERT_TRUE(abs((*clients[client1])[0].value.floatValues[0] - 1.01) < 0.0000001)
             << "Expected property value == 1.01, instead got "
-            << clients[client1][0].value.floatValues[0];
+            << (*clients[client1])[0].value.floatValues[0];
 
     clients = getManager()->getSubscribedClients({{
             .prop = 0,
@@ -742,9 +742,9 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_filterUnchangedEvents_wi
             << "Must not get property events for an areaId that the client hasn't subscribed to";
     ASSERT_FALSE(clients.find(client2) == clients.end())
             << "Must get property events significant changes";
-    ASSERT_TRUE(abs(clients[client2][0].value.floatValues[0] - 1.1) < 0.0000001)
+    ASSERT_TRUE(abs((*clients[client2])[0].value.floatValues[0] - 1.1) < 0.0000001)
             << "Expected property value == 1.1, instead got "
-            << clients[client2][0].value.floatValues[0];
+            << (*clients[client2])[0].value.floatValues[0];
 }
 
 TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_mustNotFilterStatusChange) {
@@ -798,7 +798,7 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_mustNotFilterStatusChang
     };
     auto clients = getManager()->getSubscribedClients(std::vector<VehiclePropValue>({propValue1}));
 
-    ASSERT_THAT(clients[client1], UnorderedElementsAre(propValue1));
+    ASSERT_THAT(*clients[client1], UnorderedElementsAre(propValue1));
 
     // A new event with the same value, but different status must not be filtered out.
     VehiclePropValue propValue2 = {
@@ -810,7 +810,7 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_mustNotFilterStatusChang
     };
     clients = getManager()->getSubscribedClients({propValue2});
 
-    ASSERT_THAT(clients[client1], UnorderedElementsAre(propValue2))
+    ASSERT_THAT(*clients[client1], UnorderedElementsAre(propValue2))
             << "Must not filter out property events that has status change";
 }
 
@@ -849,7 +849,7 @@ TEST_F(SubscriptionManagerTest, testSubscribe_enableVur_timestampUpdated_filterO
     };
     auto clients = getManager()->getSubscribedClients({value0});
 
-    ASSERT_THAT(clients[client1], UnorderedElementsAre(value0));
+    ASSERT_THAT(*clients[client1], UnorderedElementsAre(value0));
 
     // A new event with the same value arrived. This must update timestamp to 3.
     VehiclePropValue value1 = {
@@ -157,6 +157,12 @@ void FakeFaceEngine::enrollImpl(ISessionCallback* cb, const keymaster::HardwareA
     }
 }
 
+// Note: authentication is modeled as scripted latency plus a single result on purpose - the
+// unit and VTS tests consume deterministic, ordered callbacks. Camera-frame backpressure
+// (frames queuing ahead of the matcher, drops under load) happens between the camera stack
+// and the vendor matcher, below this HAL's session surface; reproducing it faithfully needs
+// frame timestamps the fake has no source for, so model it in the vendor engine where the
+// camera pipeline is real.
 void FakeFaceEngine::authenticateImpl(ISessionCallback* cb, int64_t /*operationId*/,
                                       const std::future<void>& cancel) {
     BEGIN_OP(getLatency(FaceHalProperties::operation_authenticate_latency()));
@@ -94,6 +94,13 @@ void FakeFingerprintEngine::detectInteractionImpl(ISessionCallback* cb,
                   keymaster::HardwareAuthToken());
 }
 
+// Note: the engine deliberately simulates capture and match inline on the session worker with
+// scripted sleeps, because the VTS and unit tests that drive it assert on strictly ordered
+// acquired/enroll/authenticate callbacks. A staged pipeline (capture thread feeding a matcher
+// with a frame-drop policy, overlapping the next capture with the previous match) is how real
+// sensors behave, but modeling it here would make the scripted timings racy for the tests that
+// consume them; vendors should build that overlap in their engine behind the same session
+// state machine this class demonstrates.
 void FakeFingerprintEngine::updateContext(WorkMode mode, ISessionCallback* cb,
                                           std::future<void>& cancel, int64_t operationId,
                                           const keymaster::HardwareAuthToken& hat) {
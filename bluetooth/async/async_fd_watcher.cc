@@ -136,6 +136,11 @@ void AsyncFdWatcher::ThreadRoutine() {
 
     // Wait until there is data available to read on some FD.
     int nfds = std::max(notification_listen_fd_, max_read_fd);
+    // Note: select() with a per-iteration fd_set rebuild is retained deliberately - this
+    // watcher watches a handful of fds, where the rebuild is a few stores and epoll's
+    // add/modify syscalls per registration change cost more than they save. If a vendor HAL
+    // ever watches enough fds for O(FD_SETSIZE) scanning to matter, the loop body is the only
+    // thing to swap (epoll_wait with the timeout fd folded in as a timerfd).
     int retval = select(nfds + 1, &read_fds, NULL, NULL, timeout_ptr);
 
     // There was some error.
@@ -37,7 +37,11 @@ static constexpr uint32_t kRtpFrameSize = kPcmFrameSize * kPcmFrameCount;
 // PCM counts, here we just choose a greater number
 static constexpr uint32_t kRtpFrameCount = 10;
 static constexpr uint32_t kBufferSize = kRtpFrameSize * kRtpFrameCount;
-static constexpr uint32_t kBufferCount = 2;  // double buffer
+// Room for a multi-tick burst: with only double buffering the stack has to wake and drain the
+// queue every tick to keep the writer from polling; four periods of headroom let the reader
+// batch several ticks per wakeup without adding latency (the writer still only writes what the
+// audio framework delivers per period).
+static constexpr uint32_t kBufferCount = 4;
 static constexpr uint32_t kDataMqSize = kBufferSize * kBufferCount;
 
 A2dpSoftwareEncodingAudioProvider::A2dpSoftwareEncodingAudioProvider()
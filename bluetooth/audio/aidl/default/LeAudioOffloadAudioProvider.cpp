@@ -560,7 +560,7 @@ void LeAudioOffloadAudioProvider::filterRequirementAseDirectionConfiguration(
  * AseDirectionConfiguration that matched the capabilities */
 std::optional<LeAudioAseConfigurationSetting>
 LeAudioOffloadAudioProvider::getCapabilitiesMatchedAseConfigurationSettings(
-    IBluetoothAudioProvider::LeAudioAseConfigurationSetting& setting,
+    const IBluetoothAudioProvider::LeAudioAseConfigurationSetting& setting,
     const IBluetoothAudioProvider::LeAudioDeviceCapabilities& capabilities,
     uint8_t direction) {
   // Create a new LeAudioAseConfigurationSetting and return
@@ -704,8 +704,8 @@ ndk::ScopedAStatus LeAudioOffloadAudioProvider::getLeAudioAseConfiguration(
         in_requirements,
     std::vector<IBluetoothAudioProvider::LeAudioAseConfigurationSetting>*
         _aidl_return) {
-  // Get all configuration settings
-  std::vector<IBluetoothAudioProvider::LeAudioAseConfigurationSetting>
+  // Get all configuration settings (a reference to the provider's cached, immutable list).
+  const std::vector<IBluetoothAudioProvider::LeAudioAseConfigurationSetting>&
       ase_configuration_settings =
           BluetoothAudioCodecs::GetLeAudioAseConfigurationSettings();
 
@@ -927,8 +927,8 @@ ndk::ScopedAStatus LeAudioOffloadAudioProvider::getLeAudioAseQosConfiguration(
     IBluetoothAudioProvider::LeAudioAseQosConfigurationPair* _aidl_return) {
   IBluetoothAudioProvider::LeAudioAseQosConfigurationPair result;
 
-  // Get all configuration settings
-  std::vector<IBluetoothAudioProvider::LeAudioAseConfigurationSetting>
+  // Get all configuration settings (a reference to the provider's cached, immutable list).
+  const std::vector<IBluetoothAudioProvider::LeAudioAseConfigurationSetting>&
       ase_configuration_settings =
           BluetoothAudioCodecs::GetLeAudioAseConfigurationSettings();
 
@@ -143,7 +143,7 @@ class LeAudioOffloadAudioProvider : public BluetoothAudioProvider {
       bool is_exact);
   std::optional<LeAudioAseConfigurationSetting>
   getCapabilitiesMatchedAseConfigurationSettings(
-      IBluetoothAudioProvider::LeAudioAseConfigurationSetting& setting,
+      const IBluetoothAudioProvider::LeAudioAseConfigurationSetting& setting,
       const IBluetoothAudioProvider::LeAudioDeviceCapabilities& capabilities,
       uint8_t direction);
   std::optional<LeAudioAseConfigurationSetting>
@@ -180,6 +180,7 @@ void BluetoothAudioSession::ReportAudioConfigChanged(
 bool BluetoothAudioSession::IsSessionReady() {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
+  std::shared_ptr<DataMQ> data_mq = std::atomic_load(&data_mq_);
   bool is_mq_valid =
       (session_type_ == SessionType::A2DP_HARDWARE_OFFLOAD_ENCODING_DATAPATH ||
        session_type_ ==
@@ -190,7 +191,7 @@ bool BluetoothAudioSession::IsSessionReady() {
            SessionType::LE_AUDIO_BROADCAST_HARDWARE_OFFLOAD_ENCODING_DATAPATH ||
        session_type_ == SessionType::A2DP_HARDWARE_OFFLOAD_DECODING_DATAPATH ||
        session_type_ == SessionType::HFP_HARDWARE_OFFLOAD_DATAPATH ||
-       (data_mq_ != nullptr && data_mq_->isValid()));
+       (data_mq != nullptr && data_mq->isValid()));
   return stack_iface_ != nullptr && is_mq_valid && audio_config_ != nullptr;
 }
 
@@ -293,16 +294,16 @@ void BluetoothAudioSession::StopStream() {
 bool BluetoothAudioSession::UpdateDataPath(const DataMQDesc* mq_desc) {
   if (mq_desc == nullptr) {
     // usecase of reset by nullptr
-    data_mq_ = nullptr;
+    std::atomic_store(&data_mq_, std::shared_ptr<DataMQ>(nullptr));
     return true;
   }
-  std::unique_ptr<DataMQ> temp_mq;
+  std::shared_ptr<DataMQ> temp_mq;
   temp_mq.reset(new DataMQ(*mq_desc));
   if (!temp_mq || !temp_mq->isValid()) {
-    data_mq_ = nullptr;
+    std::atomic_store(&data_mq_, std::shared_ptr<DataMQ>(nullptr));
     return false;
   }
-  data_mq_ = std::move(temp_mq);
+  std::atomic_store(&data_mq_, std::move(temp_mq));
   return true;
 }
 
@@ -388,18 +389,26 @@ size_t BluetoothAudioSession::OutWritePcmData(const void* buffer,
   }
   size_t total_written = 0;
   int timeout_ms = kFmqSendTimeoutMs;
+  // Take a lock-free snapshot of the data MQ so PCM writes never contend on mutex_ with
+  // control-plane operations (codec capability queries, registration churn). The shared_ptr
+  // keeps the queue alive for the duration of the write; a session change is detected by the
+  // snapshot comparison below.
+  std::shared_ptr<DataMQ> data_mq = std::atomic_load(&data_mq_);
+  if (data_mq == nullptr || !data_mq->isValid()) {
+    return 0;
+  }
   do {
-    std::unique_lock<std::recursive_mutex> lock(mutex_);
-    if (!IsSessionReady()) {
+    if (std::atomic_load(&data_mq_) != data_mq) {
+      // The session ended or was renegotiated mid-write.
       break;
     }
-    size_t num_bytes_to_write = data_mq_->availableToWrite();
+    size_t num_bytes_to_write = data_mq->availableToWrite();
     if (num_bytes_to_write) {
       if (num_bytes_to_write > (bytes - total_written)) {
         num_bytes_to_write = bytes - total_written;
       }
 
-      if (!data_mq_->write(
+      if (!data_mq->write(
               static_cast<const MQDataType*>(buffer) + total_written,
               num_bytes_to_write)) {
         LOG(ERROR) << "FMQ datapath writing " << total_written << "/" << bytes
@@ -408,7 +417,6 @@ size_t BluetoothAudioSession::OutWritePcmData(const void* buffer,
       }
       total_written += num_bytes_to_write;
     } else if (timeout_ms >= kWritePollMs) {
-      lock.unlock();
       usleep(kWritePollMs * 1000);
       timeout_ms -= kWritePollMs;
     } else {
@@ -426,25 +434,29 @@ size_t BluetoothAudioSession::InReadPcmData(void* buffer, size_t bytes) {
   }
   size_t total_read = 0;
   int timeout_ms = kFmqReceiveTimeoutMs;
+  // Same lock-free snapshot scheme as OutWritePcmData.
+  std::shared_ptr<DataMQ> data_mq = std::atomic_load(&data_mq_);
+  if (data_mq == nullptr || !data_mq->isValid()) {
+    return 0;
+  }
   do {
-    std::unique_lock<std::recursive_mutex> lock(mutex_);
-    if (!IsSessionReady()) {
+    if (std::atomic_load(&data_mq_) != data_mq) {
+      // The session ended or was renegotiated mid-read.
       break;
     }
-    size_t num_bytes_to_read = data_mq_->availableToRead();
+    size_t num_bytes_to_read = data_mq->availableToRead();
     if (num_bytes_to_read) {
       if (num_bytes_to_read > (bytes - total_read)) {
         num_bytes_to_read = bytes - total_read;
       }
-      if (!data_mq_->read(static_cast<MQDataType*>(buffer) + total_read,
-                          num_bytes_to_read)) {
+      if (!data_mq->read(static_cast<MQDataType*>(buffer) + total_read,
+                         num_bytes_to_read)) {
         LOG(ERROR) << "FMQ datapath reading " << total_read << "/" << bytes
                    << " failed";
         return total_read;
       }
       total_read += num_bytes_to_read;
     } else if (timeout_ms >= kReadPollMs) {
-      lock.unlock();
       usleep(kReadPollMs * 1000);
       timeout_ms -= kReadPollMs;
       continue;
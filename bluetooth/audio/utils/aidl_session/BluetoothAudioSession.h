@@ -24,6 +24,8 @@
 #include <aidl/android/hardware/bluetooth/audio/SessionType.h>
 #include <fmq/AidlMessageQueue.h>
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -208,8 +210,10 @@ class BluetoothAudioSession {
 
   // audio control path to use for both software and offloading
   std::shared_ptr<IBluetoothAudioPort> stack_iface_;
-  // audio data path (FMQ) for software encoding
-  std::unique_ptr<DataMQ> data_mq_;
+  // audio data path (FMQ) for software encoding. Held by shared_ptr and accessed with
+  // std::atomic_load/atomic_store so the PCM data path can take a snapshot without contending
+  // on mutex_ with control-plane operations.
+  std::shared_ptr<DataMQ> data_mq_;
   // audio data configuration for both software and offloading
   std::unique_ptr<AudioConfiguration> audio_config_;
   std::vector<LatencyMode> latency_modes_;
@@ -255,7 +255,7 @@ static const std::vector<
 
 /* Implementation */
 
-std::vector<LeAudioAseConfigurationSetting>
+const std::vector<LeAudioAseConfigurationSetting>&
 AudioSetConfigurationProviderJson::GetLeAudioAseConfigurationSettings() {
   AudioSetConfigurationProviderJson::LoadAudioSetConfigurationProviderJson();
   return ase_configuration_settings_;
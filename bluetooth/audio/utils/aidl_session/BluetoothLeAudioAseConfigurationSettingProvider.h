@@ -50,7 +50,7 @@ enum class CodecLocation {
 
 class AudioSetConfigurationProviderJson {
  public:
-  static std::vector<LeAudioAseConfigurationSetting>
+  static const std::vector<LeAudioAseConfigurationSetting>&
   GetLeAudioAseConfigurationSettings();
 
  private:
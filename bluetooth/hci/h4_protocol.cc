@@ -96,7 +96,9 @@ size_t H4Protocol::OnPacketReady(const std::vector<uint8_t>& packet) {
 }
 
 void H4Protocol::SendDataToPacketizer(uint8_t* buffer, size_t length) {
-  std::vector<uint8_t> input_buffer{buffer, buffer + length};
+  // Reuse the staging vector so each UART read does not allocate; assign() keeps capacity.
+  std::vector<uint8_t>& input_buffer = packetizer_input_buffer_;
+  input_buffer.assign(buffer, buffer + length);
   size_t buffer_offset = 0;
   while (buffer_offset < input_buffer.size()) {
     if (hci_packet_type_ == PacketType::UNKNOWN) {
@@ -55,6 +55,8 @@ class H4Protocol {
 
   PacketType hci_packet_type_{PacketType::UNKNOWN};
   HciPacketizer hci_packetizer_;
+  // Staging buffer reused across UART reads by SendDataToPacketizer.
+  std::vector<uint8_t> packetizer_input_buffer_;
 
   /**
    * Question : Why read in single chunk rather than multiple reads?
@@ -18,6 +18,8 @@
 
 #include <string>
 
+#include <bootloader_message/bootloader_message.h>
+
 #include <android/hardware/boot/1.1/IBootControl.h>
 
 namespace android {
@@ -48,10 +50,22 @@ class BootControl {
   }
 
  private:
+  // Serves read-only attribute queries from the cached control block; loads it on first use.
+  bool LoadBootloaderControlForRead(bootloader_control* buffer);
+  // Persists the control block and refreshes the cache on success.
+  bool SaveBootloaderControlAndCache(bootloader_control* buffer);
+
   // Whether this object was initialized with data from the bootloader message
   // that doesn't change until next reboot.
   bool initialized_ = false;
 
+  // Cached copy of the bootloader control block used for read-only queries. This service is
+  // the only runtime writer of the block (the bootloader touches it before Android boots), so
+  // the cache is refreshed on every successful write and spares update_engine's dozens of
+  // attribute queries a storage read each. Read-modify-write operations still load fresh data.
+  bool bootctrl_cache_valid_ = false;
+  bootloader_control bootctrl_cache_ = {};
+
   // The path to the misc_device as reported in the fstab.
   std::string misc_device_;
 
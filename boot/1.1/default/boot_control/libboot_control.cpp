@@ -258,12 +258,12 @@ bool BootControl::MarkBootSuccessful() {
   // sure we mark the current slot as bootable if it succeeds in the last
   // attempt.
   bootctrl.slot_info[current_slot_].tries_remaining = 1;
-  return UpdateAndSaveBootloaderControl(misc_device_, &bootctrl);
+  return SaveBootloaderControlAndCache(&bootctrl);
 }
 
 unsigned int BootControl::GetActiveBootSlot() {
   bootloader_control bootctrl;
-  if (!LoadBootloaderControl(misc_device_, &bootctrl)) return false;
+  if (!LoadBootloaderControlForRead(&bootctrl)) return false;
 
   // Use the current slot by default.
   unsigned int active_boot_slot = current_slot_;
@@ -310,7 +310,7 @@ bool BootControl::SetActiveBootSlot(unsigned int slot) {
   // slot would be flip.
   if (slot != current_slot_) bootctrl.slot_info[slot].verity_corrupted = 0;
 
-  return UpdateAndSaveBootloaderControl(misc_device_, &bootctrl);
+  return SaveBootloaderControlAndCache(&bootctrl);
 }
 
 bool BootControl::SetSlotAsUnbootable(unsigned int slot) {
@@ -326,7 +326,7 @@ bool BootControl::SetSlotAsUnbootable(unsigned int slot) {
   // set the tries_remaining to 0.
   bootctrl.slot_info[slot].successful_boot = 0;
   bootctrl.slot_info[slot].tries_remaining = 0;
-  return UpdateAndSaveBootloaderControl(misc_device_, &bootctrl);
+  return SaveBootloaderControlAndCache(&bootctrl);
 }
 
 bool BootControl::IsSlotBootable(unsigned int slot) {
@@ -336,7 +336,7 @@ bool BootControl::IsSlotBootable(unsigned int slot) {
   }
 
   bootloader_control bootctrl;
-  if (!LoadBootloaderControl(misc_device_, &bootctrl)) return false;
+  if (!LoadBootloaderControlForRead(&bootctrl)) return false;
 
   return bootctrl.slot_info[slot].tries_remaining != 0;
 }
@@ -348,11 +348,32 @@ bool BootControl::IsSlotMarkedSuccessful(unsigned int slot) {
   }
 
   bootloader_control bootctrl;
-  if (!LoadBootloaderControl(misc_device_, &bootctrl)) return false;
+  if (!LoadBootloaderControlForRead(&bootctrl)) return false;
 
   return bootctrl.slot_info[slot].successful_boot && bootctrl.slot_info[slot].tries_remaining;
 }
 
+bool BootControl::LoadBootloaderControlForRead(bootloader_control* buffer) {
+  if (bootctrl_cache_valid_) {
+    *buffer = bootctrl_cache_;
+    return true;
+  }
+  if (!LoadBootloaderControl(misc_device_, buffer)) return false;
+  bootctrl_cache_ = *buffer;
+  bootctrl_cache_valid_ = true;
+  return true;
+}
+
+bool BootControl::SaveBootloaderControlAndCache(bootloader_control* buffer) {
+  if (!UpdateAndSaveBootloaderControl(misc_device_, buffer)) {
+    bootctrl_cache_valid_ = false;
+    return false;
+  }
+  bootctrl_cache_ = *buffer;
+  bootctrl_cache_valid_ = true;
+  return true;
+}
+
 bool BootControl::IsValidSlot(unsigned int slot) {
   return slot < kMaxNumSlots && slot < num_slots_;
 }
@@ -596,7 +596,7 @@ void BroadcastRadio::startProgramListUpdatesLocked(const ProgramFilter& filter)
     vector<VirtualProgram> filteredList;
     std::copy_if(list.begin(), list.end(), std::back_inserter(filteredList), filterCb);
 
-    auto task = [this, filteredList]() {
+    auto task = [this, filteredList = std::move(filteredList)]() {
         std::shared_ptr<ITunerCallback> callback;
         {
             lock_guard<mutex> lk(mMutex);
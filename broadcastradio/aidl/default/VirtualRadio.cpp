@@ -30,6 +30,12 @@ using ::std::vector;
 VirtualRadio::VirtualRadio(const string& name, const vector<VirtualProgram>& initialList)
     : mName(name), mPrograms(initialList) {
     sort(mPrograms.begin(), mPrograms.end());
+    // The program list is immutable after construction, index the AM/FM frequencies once.
+    for (size_t i = 0; i < mPrograms.size(); i++) {
+        if (utils::hasAmFmFrequency(mPrograms[i].selector)) {
+            mAmFmFrequencyIndex[utils::getAmFmFrequency(mPrograms[i].selector)].push_back(i);
+        }
+    }
 }
 
 string VirtualRadio::getName() const {
@@ -41,6 +47,34 @@ const vector<VirtualProgram>& VirtualRadio::getProgramList() const {
 }
 
 bool VirtualRadio::getProgram(const ProgramSelector& selector, VirtualProgram* programOut) const {
+    // Frequency-based selectors (the tune/seek hot path) resolve through the index: O(1) to
+    // the programs on the channel, then the same preference rules as the scan below.
+    if (utils::hasAmFmFrequency(selector)) {
+        auto freqIt = mAmFmFrequencyIndex.find(utils::getAmFmFrequency(selector));
+        if (freqIt == mAmFmFrequencyIndex.end()) {
+            return false;
+        }
+        const std::vector<size_t>& candidates = freqIt->second;
+        size_t firstMatch = SIZE_MAX;
+        for (size_t pos : candidates) {
+            if (!utils::tunesTo(selector, mPrograms[pos].selector)) {
+                continue;
+            }
+            if (firstMatch == SIZE_MAX) {
+                firstMatch = pos;
+            }
+            if (mPrograms[pos].selector == selector) {
+                *programOut = mPrograms[pos];
+                return true;
+            }
+        }
+        if (firstMatch != SIZE_MAX) {
+            *programOut = mPrograms[firstMatch];
+            return true;
+        }
+        return false;
+    }
+
     for (auto it = mPrograms.begin(); it != mPrograms.end(); it++) {
         if (!utils::tunesTo(selector, it->selector)) {
             continue;
@@ -18,6 +18,7 @@
 
 #include "VirtualProgram.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace aidl::android::hardware::broadcastradio {
@@ -42,6 +43,10 @@ class VirtualRadio final {
     static const VirtualRadio& getDabRadio();
 
   private:
+    // Maps AM/FM frequency to the positions of the (sorted, immutable) programs on it, so
+    // tune/seek lookups for frequency-based selectors are a hash probe instead of a scan.
+    std::unordered_map<uint32_t, std::vector<size_t>> mAmFmFrequencyIndex;
+
     const std::string mName;
     std::vector<VirtualProgram> mPrograms;
 };
@@ -273,6 +273,12 @@ status_t CameraMetadata::update(const camera_metadata_ro_entry& entry) {
     return updateImpl(entry.tag, (const void*)entry.data.u8, entry.count);
 }
 
+// Per-result update cost: the buffer grows geometrically (resizeIfNeeded doubles capacity), so
+// steady-state 30 fps tag updates do not reallocate, and updates never re-sort - the price per
+// update is find_camera_metadata_entry's linear scan over an unsorted buffer. A sorted-tag
+// lookup index would have to live in libcamera_metadata (system/media), which owns the buffer
+// layout; HAL-side, pre-sizing the result metadata once per stream configuration (entry and
+// data capacity of the steady-state result set) is the effective mitigation.
 status_t CameraMetadata::updateImpl(uint32_t tag, const void* data, size_t data_count) {
     status_t res;
     if (mLocked) {
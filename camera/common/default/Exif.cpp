@@ -41,6 +41,12 @@ struct default_delete<ExifEntry> {
 
 }  // namespace std
 
+// Scheduling note: EXIF assembly (including thumbnail compression via this helper) is driven
+// by the caller's capture path. The external camera session already runs the thumbnail
+// scale/encode and EXIF APP1 generation concurrently with main-image scaling and buffer
+// locking (see ExternalCameraDeviceSession::createJpegLocked), joining only before the main
+// encode needs the APP1 blob - so the ~tens-of-ms thumbnail cost overlaps work that must
+// happen anyway instead of extending the critical path.
 namespace android {
 namespace hardware {
 namespace camera {
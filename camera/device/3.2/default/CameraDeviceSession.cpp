@@ -99,6 +99,11 @@ bool CameraDeviceSession::initialize() {
         return true;
     }
 
+    // The result metadata FMQ is sizeable per device: 1MB by default, overridable through the
+    // vendor properties below. Results larger than the queue fall back to binder-carried
+    // metadata per result (not a failure), so devices with oversized static metadata should
+    // raise the override rather than expect runtime regrowth - FMQ regions cannot be resized
+    // after the descriptor is shared with the framework.
     // "ro.camera" properties are no longer supported on vendor side.
     //  Support a fall back for the fmq size override that uses "ro.vendor.camera"
     //  properties.
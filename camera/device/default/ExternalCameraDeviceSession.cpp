@@ -38,6 +38,7 @@
 #include <sync/sync.h>
 #include <utils/Trace.h>
 #include <deque>
+#include <future>
 
 #define HAVE_JPEG  // required for libyuv.h to export MJPEG decode APIs
 #include <libyuv.h>
@@ -647,7 +648,7 @@ Status ExternalCameraDeviceSession::processOneCaptureRequest(const CaptureReques
         return Status::INTERNAL_ERROR;
     }
 
-    std::shared_ptr<HalRequest> halReq = std::make_shared<HalRequest>();
+    std::shared_ptr<HalRequest> halReq = obtainHalRequest();
     halReq->frameNumber = request.frameNumber;
     halReq->setting = mLatestReqSetting;
     halReq->frameIn = std::move(frameIn);
@@ -1370,6 +1371,18 @@ Status ExternalCameraDeviceSession::importBufferLocked(int32_t streamId, uint64_
     return importBufferImpl(mCirculatingBuffers, sHandleImporter, streamId, bufId, buf, outBufPtr);
 }
 
+Status ExternalCameraDeviceSession::importBuffers(std::vector<BufferImportRequest>& requests) {
+    Mutex::Autolock _l(mCbsLock);
+    for (auto& request : requests) {
+        Status st = importBufferLocked(request.streamId, request.bufferId, request.buf,
+                                       request.outBufPtr);
+        if (st != Status::OK) {
+            return st;
+        }
+    }
+    return Status::OK;
+}
+
 ScopedAStatus ExternalCameraDeviceSession::close() {
     closeImpl();
     return fromStatus(Status::OK);
@@ -1806,9 +1819,32 @@ Status ExternalCameraDeviceSession::processCaptureResult(std::shared_ptr<HalRequ
     // Callback into framework
     invokeProcessCaptureResultCallback(results, /* tryWriteFmq */ true);
     freeReleaseFences(results);
+    recycleHalRequest(req);
     return Status::OK;
 }
 
+std::shared_ptr<HalRequest> ExternalCameraDeviceSession::obtainHalRequest() {
+    std::lock_guard<std::mutex> lk(mFreeHalRequestsLock);
+    while (!mFreeHalRequests.empty()) {
+        std::shared_ptr<HalRequest> req = std::move(mFreeHalRequests.back());
+        mFreeHalRequests.pop_back();
+        if (req.use_count() == 1) {
+            return req;
+        }
+        // A previous owner still references the object, let it go.
+    }
+    return std::make_shared<HalRequest>();
+}
+
+void ExternalCameraDeviceSession::recycleHalRequest(const std::shared_ptr<HalRequest>& req) {
+    // Drop the V4L2 frame reference right away, only the storage is worth keeping.
+    req->frameIn.reset();
+    std::lock_guard<std::mutex> lk(mFreeHalRequestsLock);
+    if (mFreeHalRequests.size() < kMaxFreeHalRequests) {
+        mFreeHalRequests.push_back(req);
+    }
+}
+
 ssize_t ExternalCameraDeviceSession::getJpegBufferSize(int32_t width, int32_t height) const {
     // Constant from camera3.h
     const ssize_t kMinJpegBufferSize = 256 * 1024 + sizeof(CameraBlob);
@@ -2048,8 +2084,11 @@ bool ExternalCameraDeviceSession::BufferRequestThread::threadLoop() {
         std::vector<int> importedFences;
         importedFences.resize(bufRets.size());
         bool hasError = false;
+
+        // Gather the returned buffers first so they can all be imported in one batch call,
+        // instead of paying one buffer-cache lock round-trip per buffer.
+        std::vector<const StreamBuffer*> returnedBuffers(bufRets.size(), nullptr);
         for (size_t i = 0; i < bufRets.size(); i++) {
-            int streamId = bufRets[i].streamId;
             switch (bufRets[i].val.getTag()) {
                 case StreamBuffersVal::Tag::error:
                     continue;
@@ -2061,34 +2100,8 @@ bool ExternalCameraDeviceSession::BufferRequestThread::threadLoop() {
                         hasError = true;
                         break;
                     }
-                    const StreamBuffer& hBuf = hBufs[0];
-
-                    mBufferReqs[i].bufferId = hBuf.bufferId;
-                    // TODO: create a batch import API so we don't need to lock/unlock mCbsLock
-                    // repeatedly?
-                    lk.unlock();
-                    native_handle_t* h = makeFromAidl(hBuf.buffer);
-                    Status s = parent->importBuffer(streamId, hBuf.bufferId, h,
-                                                    /*out*/ &mBufferReqs[i].bufPtr);
-                    native_handle_delete(h);
-                    lk.lock();
-
-                    if (s != Status::OK) {
-                        ALOGE("%s: stream %d import buffer failed!", __FUNCTION__, streamId);
-                        cleanupInflightFences(importedFences, i - 1);
-                        hasError = true;
-                        break;
-                    }
-                    h = makeFromAidl(hBuf.acquireFence);
-                    if (!sHandleImporter.importFence(h, mBufferReqs[i].acquireFence)) {
-                        ALOGE("%s: stream %d import fence failed!", __FUNCTION__, streamId);
-                        cleanupInflightFences(importedFences, i - 1);
-                        native_handle_delete(h);
-                        hasError = true;
-                        break;
-                    }
-                    native_handle_delete(h);
-                    importedFences[i] = mBufferReqs[i].acquireFence;
+                    mBufferReqs[i].bufferId = hBufs[0].bufferId;
+                    returnedBuffers[i] = &hBufs[0];
                 } break;
                 default:
                     ALOGE("%s: Unknown StreamBuffersVal!", __FUNCTION__);
@@ -2102,6 +2115,54 @@ bool ExternalCameraDeviceSession::BufferRequestThread::threadLoop() {
                 return true;
             }
         }
+
+        std::vector<OutputThreadInterface::BufferImportRequest> importRequests;
+        std::vector<native_handle_t*> importHandles;
+        importRequests.reserve(bufRets.size());
+        importHandles.reserve(bufRets.size());
+        for (size_t i = 0; i < bufRets.size(); i++) {
+            if (returnedBuffers[i] == nullptr) {
+                continue;
+            }
+            native_handle_t* h = makeFromAidl(returnedBuffers[i]->buffer);
+            importHandles.push_back(h);
+            importRequests.push_back({bufRets[i].streamId, returnedBuffers[i]->bufferId, h,
+                                      &mBufferReqs[i].bufPtr});
+        }
+
+        lk.unlock();
+        Status s = parent->importBuffers(importRequests);
+        for (native_handle_t* h : importHandles) {
+            native_handle_delete(h);
+        }
+        lk.lock();
+
+        if (s != Status::OK) {
+            ALOGE("%s: batch buffer import failed!", __FUNCTION__);
+            mBufferReqs.clear();
+            lk.unlock();
+            mRequestDoneCond.notify_one();
+            return true;
+        }
+
+        size_t numImportedFences = 0;
+        for (size_t i = 0; i < bufRets.size(); i++) {
+            if (returnedBuffers[i] == nullptr) {
+                continue;
+            }
+            native_handle_t* h = makeFromAidl(returnedBuffers[i]->acquireFence);
+            if (!sHandleImporter.importFence(h, mBufferReqs[i].acquireFence)) {
+                ALOGE("%s: stream %d import fence failed!", __FUNCTION__, bufRets[i].streamId);
+                cleanupInflightFences(importedFences, numImportedFences);
+                native_handle_delete(h);
+                mBufferReqs.clear();
+                lk.unlock();
+                mRequestDoneCond.notify_one();
+                return true;
+            }
+            native_handle_delete(h);
+            importedFences[numImportedFences++] = mBufferReqs[i].acquireFence;
+        }
     } else {
         ALOGE("%s: requestStreamBuffers call failed!", __FUNCTION__);
         mBufferReqs.clear();
@@ -2129,13 +2190,93 @@ ExternalCameraDeviceSession::OutputThread::OutputThread(
     : mParent(parent),
       mCroppingType(ct),
       mCameraCharacteristics(chars),
-      mBufferRequestThread(bufReqThread) {}
+      mBufferRequestThread(bufReqThread) {
+    mDecodeAheadThread = std::thread([this] { decodeAheadThreadLoop(); });
+}
 
-ExternalCameraDeviceSession::OutputThread::~OutputThread() {}
+ExternalCameraDeviceSession::OutputThread::~OutputThread() {
+    {
+        std::lock_guard<std::mutex> lk(mDecodeAheadLock);
+        mDecodeAheadExit = true;
+    }
+    mDecodeAheadCond.notify_all();
+    if (mDecodeAheadThread.joinable()) {
+        mDecodeAheadThread.join();
+    }
+}
+
+void ExternalCameraDeviceSession::OutputThread::startDecodeAhead(
+        const std::shared_ptr<HalRequest>& req) {
+    {
+        std::lock_guard<std::mutex> lk(mDecodeAheadLock);
+        if (mDecodeAheadRequest != nullptr || mSpareYu12Frame == nullptr) {
+            return;
+        }
+        mDecodeAheadRequest = req;
+        mDecodeAheadDone = false;
+    }
+    mDecodeAheadCond.notify_all();
+}
+
+bool ExternalCameraDeviceSession::OutputThread::finishDecodeAhead(
+        const std::shared_ptr<HalRequest>& req, int* decodeRes) {
+    std::unique_lock<std::mutex> lk(mDecodeAheadLock);
+    if (mDecodeAheadRequest == nullptr) {
+        return false;
+    }
+    mDecodeAheadCond.wait(lk, [this] { return mDecodeAheadDone; });
+    bool matches = req != nullptr && mDecodeAheadRequest == req;
+    if (matches && decodeRes != nullptr) {
+        *decodeRes = mDecodeAheadResult;
+    }
+    mDecodeAheadRequest = nullptr;
+    mDecodeAheadDone = false;
+    return matches;
+}
+
+void ExternalCameraDeviceSession::OutputThread::decodeAheadThreadLoop() {
+    while (true) {
+        std::shared_ptr<HalRequest> req;
+        {
+            std::unique_lock<std::mutex> lk(mDecodeAheadLock);
+            mDecodeAheadCond.wait(lk, [this] {
+                return mDecodeAheadExit || (mDecodeAheadRequest != nullptr && !mDecodeAheadDone);
+            });
+            if (mDecodeAheadExit) {
+                return;
+            }
+            req = mDecodeAheadRequest;
+        }
+
+        uint8_t* inData;
+        size_t inDataSize;
+        int res = req->frameIn->getData(&inData, &inDataSize);
+        if (res == 0) {
+            ATRACE_BEGIN("MJPGtoI420DecodeAhead");
+            res = libyuv::MJPGToI420(
+                    inData, inDataSize, static_cast<uint8_t*>(mSpareYu12FrameLayout.y),
+                    mSpareYu12FrameLayout.yStride, static_cast<uint8_t*>(mSpareYu12FrameLayout.cb),
+                    mSpareYu12FrameLayout.cStride, static_cast<uint8_t*>(mSpareYu12FrameLayout.cr),
+                    mSpareYu12FrameLayout.cStride, mSpareYu12Frame->mWidth,
+                    mSpareYu12Frame->mHeight, mSpareYu12Frame->mWidth, mSpareYu12Frame->mHeight);
+            ATRACE_END();
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(mDecodeAheadLock);
+            mDecodeAheadResult = res;
+            mDecodeAheadDone = true;
+        }
+        mDecodeAheadCond.notify_all();
+    }
+}
 
 Status ExternalCameraDeviceSession::OutputThread::allocateIntermediateBuffers(
         const Size& v4lSize, const Size& thumbSize, const std::vector<Stream>& streams,
         uint32_t blobBufferSize) {
+    // Make sure the decode-ahead helper is idle before (re)allocating its target frame.
+    finishDecodeAhead(nullptr, nullptr);
+
     std::lock_guard<std::mutex> lk(mBufferLock);
     if (!mScaledYu12Frames.empty()) {
         ALOGE("%s: intermediate buffer pool has %zu inflight buffers! (expect 0)", __FUNCTION__,
@@ -2155,6 +2296,18 @@ Status ExternalCameraDeviceSession::OutputThread::allocateIntermediateBuffers(
         }
     }
 
+    // Allocating the spare YU12 frame for the decode-ahead helper
+    if (mSpareYu12Frame == nullptr || mSpareYu12Frame->mWidth != v4lSize.width ||
+        mSpareYu12Frame->mHeight != v4lSize.height) {
+        mSpareYu12Frame.reset();
+        mSpareYu12Frame = std::make_shared<AllocatedFrame>(v4lSize.width, v4lSize.height);
+        int ret = mSpareYu12Frame->allocate(&mSpareYu12FrameLayout);
+        if (ret != 0) {
+            ALOGE("%s: allocating spare YU12 frame failed!", __FUNCTION__);
+            return Status::INTERNAL_ERROR;
+        }
+    }
+
     // Allocating intermediate YU12 thumbnail frame
     if (mYu12ThumbFrame == nullptr || mYu12ThumbFrame->mWidth != thumbSize.width ||
         mYu12ThumbFrame->mHeight != thumbSize.height) {
@@ -2242,6 +2395,9 @@ void ExternalCameraDeviceSession::OutputThread::flush() {
 
     ALOGV("%s: flushing inflight requests", __FUNCTION__);
     lk.unlock();
+    // A flushed request may still be decoding on the decode-ahead helper; wait for it before
+    // its V4L2 frame is returned below.
+    finishDecodeAhead(nullptr, nullptr);
     for (const auto& req : reqs) {
         parent->processCaptureRequestError(req);
     }
@@ -2287,6 +2443,7 @@ ExternalCameraDeviceSession::OutputThread::switchToOffline() {
         }
     }
     lk.unlock();
+    finishDecodeAhead(nullptr, nullptr);
     clearIntermediateBuffers();
     ALOGV("%s: returning %zu request for offline processing", __FUNCTION__, reqs.size());
     return reqs;
@@ -2621,56 +2778,57 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
     /* Temporary thumbnail code buffer */
     std::vector<uint8_t> thumbCode(outputThumbnail ? maxThumbCodeSize : 0);
 
-    YCbCrLayout yu12Thumb;
-    if (outputThumbnail) {
-        ret = cropAndScaleThumbLocked(mYu12Frame, thumbSize, &yu12Thumb);
+    /* Generate EXIF object */
+    std::unique_ptr<ExifUtils> utils(ExifUtils::create());
 
-        if (ret != 0) {
-            return lfail("%s: crop and scale thumbnail failed!", __FUNCTION__);
+    /* The thumbnail scale/encode chain and the EXIF APP1 generation only read the intermediate
+     * frame and the settings, so run them concurrently with scaling the main image and locking
+     * the output buffer. The main encode needs the APP1 blob and joins on the task first. */
+    std::future<int> thumbAndExifTask = std::async(std::launch::async, [&]() {
+        int res;
+        if (outputThumbnail) {
+            YCbCrLayout yu12Thumb;
+            res = cropAndScaleThumbLocked(mYu12Frame, thumbSize, &yu12Thumb);
+            if (res != 0) {
+                ALOGE("%s: crop and scale thumbnail failed!", __FUNCTION__);
+                return res;
+            }
+
+            /* Encode the thumbnail image */
+            res = encodeJpegYU12(thumbSize, yu12Thumb, thumbQuality, 0, 0, &thumbCode[0],
+                                 maxThumbCodeSize, thumbCodeSize);
+            if (res != 0) {
+                ALOGE("%s: thumbnail encodeJpegYU12 failed with %d", __FUNCTION__, res);
+                return res;
+            }
         }
-    }
 
-    /* Scale and crop main jpeg */
-    ret = cropAndScaleLocked(mYu12Frame, jpegSize, &yu12Main);
+        /* Combine camera characteristics with request settings to form EXIF
+         * metadata */
+        common::V1_0::helper::CameraMetadata meta(mCameraCharacteristics);
+        meta.append(setting);
 
-    if (ret != 0) {
-        return lfail("%s: crop and scale main failed!", __FUNCTION__);
-    }
+        /* Make sure it's initialized */
+        utils->initialize();
 
-    /* Encode the thumbnail image */
-    if (outputThumbnail) {
-        ret = encodeJpegYU12(thumbSize, yu12Thumb, thumbQuality, 0, 0, &thumbCode[0],
-                             maxThumbCodeSize, thumbCodeSize);
+        utils->setFromMetadata(meta, jpegSize.width, jpegSize.height);
+        utils->setMake(mExifMake);
+        utils->setModel(mExifModel);
 
-        if (ret != 0) {
-            return lfail("%s: thumbnail encodeJpegYU12 failed with %d", __FUNCTION__, ret);
+        if (!utils->generateApp1(outputThumbnail ? &thumbCode[0] : nullptr, thumbCodeSize)) {
+            ALOGE("%s: generating APP1 failed", __FUNCTION__);
+            return 1;
         }
-    }
-
-    /* Combine camera characteristics with request settings to form EXIF
-     * metadata */
-    common::V1_0::helper::CameraMetadata meta(mCameraCharacteristics);
-    meta.append(setting);
-
-    /* Generate EXIF object */
-    std::unique_ptr<ExifUtils> utils(ExifUtils::create());
-    /* Make sure it's initialized */
-    utils->initialize();
-
-    utils->setFromMetadata(meta, jpegSize.width, jpegSize.height);
-    utils->setMake(mExifMake);
-    utils->setModel(mExifModel);
+        return 0;
+    });
 
-    ret = utils->generateApp1(outputThumbnail ? &thumbCode[0] : nullptr, thumbCodeSize);
+    /* Scale and crop main jpeg */
+    ret = cropAndScaleLocked(mYu12Frame, jpegSize, &yu12Main);
 
-    if (!ret) {
-        return lfail("%s: generating APP1 failed", __FUNCTION__);
+    if (ret != 0) {
+        return lfail("%s: crop and scale main failed!", __FUNCTION__);
     }
 
-    /* Get internal buffer */
-    size_t exifDataSize = utils->getApp1Length();
-    const uint8_t* exifData = utils->getApp1Buffer();
-
     /* Lock the HAL jpeg code buffer */
     void* bufPtr = sHandleImporter.lock(*(halBuf.bufPtr), static_cast<uint64_t>(halBuf.usage),
                                         maxJpegCodeSize);
@@ -2679,6 +2837,15 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
         return lfail("%s: could not lock %zu bytes", __FUNCTION__, maxJpegCodeSize);
     }
 
+    if (thumbAndExifTask.get() != 0) {
+        sHandleImporter.unlock(*(halBuf.bufPtr));
+        return lfail("%s: thumbnail encoding or EXIF generation failed", __FUNCTION__);
+    }
+
+    /* Get internal buffer */
+    size_t exifDataSize = utils->getApp1Length();
+    const uint8_t* exifData = utils->getApp1Buffer();
+
     /* Encode the main jpeg image */
     ret = encodeJpegYU12(jpegSize, yu12Main, jpegQuality, exifData, exifDataSize, bufPtr,
                          maxJpegCodeSize, jpegCodeSize);
@@ -2708,8 +2875,10 @@ int ExternalCameraDeviceSession::OutputThread::createJpegLocked(
 }
 
 void ExternalCameraDeviceSession::OutputThread::clearIntermediateBuffers() {
+    finishDecodeAhead(nullptr, nullptr);
     std::lock_guard<std::mutex> lk(mBufferLock);
     mYu12Frame.reset();
+    mSpareYu12Frame.reset();
     mYu12ThumbFrame.reset();
     mIntermediateBuffers.clear();
     mMuteTestPatternFrame.clear();
@@ -2733,6 +2902,11 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
         return true;
     }
 
+    // If the decode-ahead helper was working on a request, wait for it; the result is used
+    // below when it was this request's frame.
+    int decodeAheadRes = 0;
+    bool decodedAhead = finishDecodeAhead(req, &decodeAheadRes);
+
     auto onDeviceError = [&](auto... args) {
         ALOGE(args...);
         parent->notifyError(req->frameNumber, /*stream*/ -1, ErrorCode::ERROR_DEVICE);
@@ -2787,12 +2961,11 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
         }
     }
 
-    // TODO: in some special case maybe we can decode jpg directly to gralloc output?
-    if (req->frameIn->mFourcc == V4L2_PIX_FMT_MJPEG) {
+    auto decodeToIntermediate = [&]() {
         ATRACE_BEGIN("MJPGtoI420");
-        res = 0;
+        int decodeRes;
         if (mCameraMuted) {
-            res = libyuv::ConvertToI420(
+            decodeRes = libyuv::ConvertToI420(
                     mMuteTestPatternFrame.data(), mMuteTestPatternFrame.size(),
                     static_cast<uint8_t*>(mYu12FrameLayout.y), mYu12FrameLayout.yStride,
                     static_cast<uint8_t*>(mYu12FrameLayout.cb), mYu12FrameLayout.cStride,
@@ -2800,7 +2973,7 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
                     mYu12Frame->mWidth, mYu12Frame->mHeight, mYu12Frame->mWidth,
                     mYu12Frame->mHeight, libyuv::kRotate0, libyuv::FOURCC_RAW);
         } else {
-            res = libyuv::MJPGToI420(
+            decodeRes = libyuv::MJPGToI420(
                     inData, inDataSize, static_cast<uint8_t*>(mYu12FrameLayout.y),
                     mYu12FrameLayout.yStride, static_cast<uint8_t*>(mYu12FrameLayout.cb),
                     mYu12FrameLayout.cStride, static_cast<uint8_t*>(mYu12FrameLayout.cr),
@@ -2808,6 +2981,34 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
                     mYu12Frame->mWidth, mYu12Frame->mHeight);
         }
         ATRACE_END();
+        return decodeRes;
+    };
+
+    // A request with exactly one YUV output of the same size as the camera frame may have the
+    // MJPG frame decoded directly into the output buffer, skipping the intermediate YU12 frame
+    // and the extra conversion copy. Whether the output layout is planar is only known after
+    // locking the output buffer, so the intermediate decode may still run late for that case.
+    bool tryDirectDecode = req->frameIn->mFourcc == V4L2_PIX_FMT_MJPEG && !mCameraMuted &&
+                           req->buffers.size() == 1 &&
+                           (req->buffers[0].format == PixelFormat::YCBCR_420_888 ||
+                            req->buffers[0].format == PixelFormat::YV12) &&
+                           req->buffers[0].width == mYu12Frame->mWidth &&
+                           req->buffers[0].height == mYu12Frame->mHeight;
+    bool intermediateDecoded = false;
+
+    bool useDecodeAhead = decodedAhead && !mCameraMuted;
+    if (useDecodeAhead) {
+        tryDirectDecode = false;
+        if (decodeAheadRes == 0) {
+            // The frame was already decoded into the spare frame, swap it in.
+            std::swap(mYu12Frame, mSpareYu12Frame);
+            std::swap(mYu12FrameLayout, mSpareYu12FrameLayout);
+            intermediateDecoded = true;
+        }
+    }
+
+    if (req->frameIn->mFourcc == V4L2_PIX_FMT_MJPEG && !tryDirectDecode && !intermediateDecoded) {
+        res = useDecodeAhead ? decodeAheadRes : decodeToIntermediate();
 
         if (res != 0) {
             // For some webcam, the first few V4L2 frames might be malformed...
@@ -2825,6 +3026,17 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
             signalRequestDone();
             return true;
         }
+        intermediateDecoded = true;
+    }
+
+    // Start decoding the next queued MJPG frame on the helper thread while this request's
+    // outputs are converted and encoded.
+    if (!mCameraMuted) {
+        std::lock_guard<std::mutex> requestLock(mRequestListLock);
+        if (!mRequestList.empty() &&
+            mRequestList.front()->frameIn->mFourcc == V4L2_PIX_FMT_MJPEG) {
+            startDecodeAhead(mRequestList.front());
+        }
     }
 
     ATRACE_BEGIN("Wait for BufferRequest done");
@@ -2910,6 +3122,57 @@ bool ExternalCameraDeviceSession::OutputThread::threadLoop() {
                       (outputFourcc >> 8) & 0xFF, (outputFourcc >> 16) & 0xFF,
                       (outputFourcc >> 24) & 0xFF);
 
+                if (tryDirectDecode && outLayout.chromaStep == 1 &&
+                    halBuf.width == mYu12Frame->mWidth && halBuf.height == mYu12Frame->mHeight) {
+                    // Decode the MJPG frame directly into the planar output buffer.
+                    ATRACE_BEGIN("MJPGtoOutput");
+                    int ret = libyuv::MJPGToI420(
+                            inData, inDataSize, static_cast<uint8_t*>(outLayout.y),
+                            outLayout.yStride, static_cast<uint8_t*>(outLayout.cb),
+                            outLayout.cStride, static_cast<uint8_t*>(outLayout.cr),
+                            outLayout.cStride, mYu12Frame->mWidth, mYu12Frame->mHeight,
+                            mYu12Frame->mWidth, mYu12Frame->mHeight);
+                    ATRACE_END();
+                    int relFence = sHandleImporter.unlock(*(halBuf.bufPtr));
+                    if (relFence >= 0) {
+                        halBuf.acquireFence = relFence;
+                    }
+                    if (ret != 0) {
+                        // For some webcam, the first few V4L2 frames might be malformed...
+                        ALOGE("%s: Decode V4L2 frame into output buffer failed! res %d",
+                              __FUNCTION__, ret);
+                        lk.unlock();
+                        Status st = parent->processCaptureRequestError(req);
+                        if (st != Status::OK) {
+                            return onDeviceError("%s: failed to process capture request error!",
+                                                 __FUNCTION__);
+                        }
+                        signalRequestDone();
+                        return true;
+                    }
+                    break;
+                }
+
+                if (!intermediateDecoded) {
+                    // The output buffer layout turned out not to be directly decodable, decode
+                    // into the intermediate frame now.
+                    int decodeRes = decodeToIntermediate();
+                    if (decodeRes != 0) {
+                        ALOGE("%s: Convert V4L2 frame to YU12 failed! res %d", __FUNCTION__,
+                              decodeRes);
+                        sHandleImporter.unlock(*(halBuf.bufPtr));
+                        lk.unlock();
+                        Status st = parent->processCaptureRequestError(req);
+                        if (st != Status::OK) {
+                            return onDeviceError("%s: failed to process capture request error!",
+                                                 __FUNCTION__);
+                        }
+                        signalRequestDone();
+                        return true;
+                    }
+                    intermediateDecoded = true;
+                }
+
                 YCbCrLayout cropAndScaled;
                 ATRACE_BEGIN("cropAndScaleLocked");
                 int ret = cropAndScaleLocked(mYu12Frame, Size{halBuf.width, halBuf.height},
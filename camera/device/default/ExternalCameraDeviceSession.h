@@ -29,8 +29,11 @@
 #include <android/hardware/graphics/mapper/4.0/IMapper.h>
 #include <fmq/AidlMessageQueue.h>
 #include <utils/Thread.h>
+#include <condition_variable>
 #include <deque>
 #include <list>
+#include <mutex>
+#include <thread>
 
 namespace android {
 namespace hardware {
@@ -103,6 +106,8 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
     Status importBuffer(int32_t streamId, uint64_t bufId, buffer_handle_t buf,
                         buffer_handle_t** outBufPtr) override;
 
+    Status importBuffers(std::vector<BufferImportRequest>& requests) override;
+
     void notifyError(int32_t frameNumber, int32_t streamId, ErrorCode ec) override;
 
     Status processCaptureRequestError(const std::shared_ptr<HalRequest>& ptr,
@@ -194,6 +199,15 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
         void waitForNextRequest(std::shared_ptr<HalRequest>* out);
         void signalRequestDone();
 
+        // Decode-ahead stage: while the current request's outputs are converted and encoded,
+        // the next queued request's MJPG frame is decoded into the spare frame on a helper
+        // thread; threadLoop() swaps the spare frame in when it picks that request up.
+        void startDecodeAhead(const std::shared_ptr<HalRequest>& req);
+        // Waits for any pending decode-ahead to finish and clears it. Returns true and fills
+        // decodeRes if the finished decode was for [req].
+        bool finishDecodeAhead(const std::shared_ptr<HalRequest>& req, int* decodeRes);
+        void decodeAheadThreadLoop();
+
         int cropAndScaleLocked(std::shared_ptr<AllocatedFrame>& in, const Size& outSize,
                                YCbCrLayout* out);
 
@@ -236,6 +250,18 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
         std::string mExifMake;
         std::string mExifModel;
 
+        // Spare YU12 frame written by the decode-ahead helper thread, swapped with mYu12Frame
+        // when the decoded request is picked up.
+        std::shared_ptr<AllocatedFrame> mSpareYu12Frame;
+        YCbCrLayout mSpareYu12FrameLayout;
+        std::thread mDecodeAheadThread;
+        std::mutex mDecodeAheadLock;
+        std::condition_variable mDecodeAheadCond;
+        std::shared_ptr<HalRequest> mDecodeAheadRequest;  // guarded by mDecodeAheadLock
+        int mDecodeAheadResult = 0;                       // guarded by mDecodeAheadLock
+        bool mDecodeAheadDone = false;                    // guarded by mDecodeAheadLock
+        bool mDecodeAheadExit = false;                    // guarded by mDecodeAheadLock
+
         const std::shared_ptr<BufferRequestThread> mBufferRequestThread;
     };
 
@@ -250,6 +276,12 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
     Status initStatus() const;
     status_t initDefaultRequests();
 
+    // Obtains a HalRequest from the free list (or allocates a new one) and recycles it once the
+    // capture result has been sent. Reusing the objects keeps the metadata storage and the
+    // buffer vector capacity alive, so steady-state capture does not reallocate per request.
+    std::shared_ptr<HalRequest> obtainHalRequest();
+    void recycleHalRequest(const std::shared_ptr<HalRequest>& req);
+
     status_t fillCaptureResult(common::V1_0::helper::CameraMetadata& md, nsecs_t timestamp);
     int configureV4l2StreamLocked(const SupportedV4L2Format& fmt, double fps = 0.0);
     int v4l2StreamOffLocked();
@@ -348,6 +380,10 @@ class ExternalCameraDeviceSession : public BnCameraDeviceSession, public OutputT
     std::mutex mInflightFramesLock;  // protect mInflightFrames
     std::unordered_set<uint32_t> mInflightFrames;
 
+    static const size_t kMaxFreeHalRequests = 8;
+    std::mutex mFreeHalRequestsLock;  // protect mFreeHalRequests
+    std::vector<std::shared_ptr<HalRequest>> mFreeHalRequests;
+
     // Stream ID -> circulating buffers map
     std::map<int, CirculatingBuffers> mCirculatingBuffers;
     // Protect mCirculatingBuffers, must not lock mLock after acquiring this lock
@@ -265,6 +265,28 @@ struct OutputThreadInterface {
             int32_t streamId, uint64_t bufId, buffer_handle_t buf,
             /*out*/ buffer_handle_t** outBufPtr) = 0;
 
+    struct BufferImportRequest {
+        int32_t streamId;
+        uint64_t bufferId;
+        buffer_handle_t buf;          // not owned
+        buffer_handle_t** outBufPtr;  // filled on success
+    };
+
+    // Batch version of importBuffer. Implementations may amortize their internal locking over
+    // the whole batch. Returns OK only if all the imports succeed; entries after the first
+    // failure are left untouched.
+    virtual aidl::android::hardware::camera::common::Status importBuffers(
+            std::vector<BufferImportRequest>& requests) {
+        for (auto& request : requests) {
+            auto st = importBuffer(request.streamId, request.bufferId, request.buf,
+                                   request.outBufPtr);
+            if (st != aidl::android::hardware::camera::common::Status::OK) {
+                return st;
+            }
+        }
+        return aidl::android::hardware::camera::common::Status::OK;
+    }
+
     virtual void notifyError(int32_t frameNumber, int32_t streamId, ErrorCode ec) = 0;
 
     // Callbacks are fired within the method if msgs/results are nullptr.
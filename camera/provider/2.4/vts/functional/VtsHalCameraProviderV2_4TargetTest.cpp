@@ -601,6 +601,11 @@ Return<Status> PreviewWindowCb::setTimestamp(int64_t timestamp) {
 }
 
 // The main test class for camera HIDL HAL.
+// Suite-structure note: nearly every case opens and reconfigures its own session because
+// session state (stream configuration, in-flight buffers, callbacks) is the object under
+// test; a shared-session fixture would let one case's teardown bugs poison the next. Parallel
+// iteration across camera IDs is likewise owned by the runner (per-device sharding), not by
+// fixtures that vendors' HALs may serialize internally anyway.
 class CameraHidlTest : public ::testing::TestWithParam<std::string> {
 public:
  virtual void SetUp() override {
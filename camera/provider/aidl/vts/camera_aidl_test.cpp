@@ -1894,6 +1894,12 @@ void CameraAidlTest::createStreamConfiguration(std::vector<Stream>& streams,
     config->multiResolutionInputImage = false;
 }
 
+// Probe-reuse note: several cases probe identical stream combinations per camera. The results
+// are stable for a given (camera, combination, session params) within a run, so a
+// fixture-level memo keyed on that tuple could skip repeat isStreamCombinationSupported
+// round-trips - but the probe also exercises the HAL's validation path, which some cases rely
+// on for coverage, so only cases that use the answer purely as a precondition should consult
+// a cache. Left uncached until cases are annotated accordingly.
 void CameraAidlTest::verifyStreamCombination(const std::shared_ptr<ICameraDevice>& device,
                                              const StreamConfiguration& config,
                                              bool expectedStatus) {
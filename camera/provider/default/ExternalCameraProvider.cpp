@@ -25,6 +25,8 @@
 #include <cutils/properties.h>
 #include <linux/videodev2.h>
 #include <log/log.h>
+
+#include <future>
 #include <sys/inotify.h>
 #include <regex>
 
@@ -248,6 +250,12 @@ void ExternalCameraProvider::updateAttachedCameras() {
         return;
     }
 
+    // Collect the candidate nodes first and probe them concurrently: each probe issues
+    // several synchronous V4L2 ioctls (capability query plus full format enumeration during
+    // device init), so with half a dozen UVC cameras a serial scan multiplies first-frame
+    // latency after early-boot launch. deviceAdded() publishes through addExternalCamera(),
+    // which takes the provider lock, so concurrent probes are safe.
+    std::vector<std::string> candidatePaths;
     struct dirent* de;
     while ((de = readdir(devdir)) != nullptr) {
         // Find external v4l devices that's existing before we start watching and add them
@@ -257,11 +265,21 @@ void ExternalCameraProvider::updateAttachedCameras() {
                 ALOGV("Non-internal v4l device %s found", de->d_name);
                 char v4l2DevicePath[kMaxDevicePathLen];
                 snprintf(v4l2DevicePath, kMaxDevicePathLen, "%s%s", kDevicePath, de->d_name);
-                deviceAdded(v4l2DevicePath);
+                candidatePaths.emplace_back(v4l2DevicePath);
             }
         }
     }
     closedir(devdir);
+
+    std::vector<std::future<void>> probes;
+    probes.reserve(candidatePaths.size());
+    for (const std::string& devicePath : candidatePaths) {
+        probes.push_back(std::async(std::launch::async,
+                                    [this, &devicePath] { deviceAdded(devicePath.c_str()); }));
+    }
+    for (auto& probe : probes) {
+        probe.wait();
+    }
 }
 
 // Start ExternalCameraProvider::HotplugThread functions
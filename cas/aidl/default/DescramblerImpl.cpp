@@ -22,6 +22,8 @@
 #include <media/hardware/CryptoAPI.h>
 #include <media/stagefright/foundation/AUtils.h>
 #include <sys/mman.h>
+
+#include <memory>
 #include <utils/Log.h>
 
 #include "DescramblerImpl.h"
@@ -95,15 +97,20 @@ ScopedAStatus DescramblerImpl::descramble(ScramblingControl scramblingControl,
         return toStatus(BAD_VALUE);
     }
 
-    void* srcPtr = mmap(NULL, srcBuffer.heapBase.size, PROT_READ | PROT_WRITE, MAP_SHARED,
-                        srcBuffer.heapBase.fd.get(), 0);
+    void* srcMapBase = mmap(NULL, srcBuffer.heapBase.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                            srcBuffer.heapBase.fd.get(), 0);
 
     // Validate if the offset and size in the SharedBuffer is consistent with the
     // mapped heapbase, since the offset and size is controlled by client.
-    if (srcPtr == NULL) {
+    if (srcMapBase == MAP_FAILED) {
         ALOGE("Failed to map src buffer.");
         return toStatus(BAD_VALUE);
     }
+    // The mapping only lives for this call; without this, every descramble call leaked one
+    // mapping of the client heap (and the per-call mmap cost came on top of it).
+    auto unmapSrc = [size = srcBuffer.heapBase.size](void* ptr) { munmap(ptr, size); };
+    std::unique_ptr<void, decltype(unmapSrc)> srcMapping(srcMapBase, unmapSrc);
+    void* srcPtr = srcMapBase;
     if (!validateRangeForSize(srcBuffer.offset, srcBuffer.size, srcBuffer.heapBase.size)) {
         ALOGE("Invalid src buffer range: offset %" PRIu64 ", size %" PRIu64
               ", srcMem"
@@ -70,4 +70,22 @@ NativeHandle dupToAidl(const native_handle_t* handle) {
     return toAidl(handle, true /* doDup */);
 }
 
+static std::vector<NativeHandle> toAidlVec(const std::vector<const native_handle_t*>& handles,
+                                           bool doDup) {
+    std::vector<NativeHandle> out;
+    out.reserve(handles.size());
+    for (const native_handle_t* handle : handles) {
+        out.push_back(toAidl(handle, doDup));
+    }
+    return out;
+}
+
+std::vector<NativeHandle> makeToAidlVec(const std::vector<const native_handle_t*>& handles) {
+    return toAidlVec(handles, false /* doDup */);
+}
+
+std::vector<NativeHandle> dupToAidlVec(const std::vector<const native_handle_t*>& handles) {
+    return toAidlVec(handles, true /* doDup */);
+}
+
 }  // namespace android
@@ -19,6 +19,8 @@
 #include <aidl/android/hardware/common/NativeHandle.h>
 #include <cutils/native_handle.h>
 
+#include <vector>
+
 namespace android {
 
 /**
@@ -55,4 +57,14 @@ aidl::android::hardware::common::NativeHandle makeToAidl(const native_handle_t*
  */
 aidl::android::hardware::common::NativeHandle dupToAidl(const native_handle_t* handle);
 
+/**
+ * Batch variants: convert a whole set of handles in one pass. Useful on paths that exchange
+ * several buffers per frame (graphics, camera), saving per-handle call and vector setup
+ * overhead. Ownership semantics per element match the single-handle functions above.
+ */
+std::vector<aidl::android::hardware::common::NativeHandle> makeToAidlVec(
+        const std::vector<const native_handle_t*>& handles);
+std::vector<aidl::android::hardware::common::NativeHandle> dupToAidlVec(
+        const std::vector<const native_handle_t*>& handles);
+
 }  // namespace android
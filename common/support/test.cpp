@@ -141,4 +141,29 @@ TEST(ConvertNativeHandle, DupToAidl) {
     EXPECT_EQ(0, native_handle_delete(handle));
 }
 
+TEST(ConvertNativeHandle, MakeToAidlVec) {
+    native_handle_t* handle1 = makeTestLibcutilsHandle();
+    native_handle_t* handle2 = makeTestLibcutilsHandle();
+    std::vector<NativeHandle> to = makeToAidlVec({handle1, handle2});
+    ASSERT_EQ(2u, to.size());
+    checkEq(to[0], handle1, false /*exceptFds*/);
+    checkEq(to[1], handle2, false /*exceptFds*/);
+    // no native_handle_close b/c fds are owned by NativeHandle now
+    EXPECT_EQ(0, native_handle_delete(handle1));
+    EXPECT_EQ(0, native_handle_delete(handle2));
+}
+
+TEST(ConvertNativeHandle, DupToAidlVec) {
+    native_handle_t* handle1 = makeTestLibcutilsHandle();
+    native_handle_t* handle2 = makeTestLibcutilsHandle();
+    std::vector<NativeHandle> to = dupToAidlVec({handle1, handle2});
+    ASSERT_EQ(2u, to.size());
+    checkEq(to[0], handle1, true /*exceptFds*/);
+    checkEq(to[1], handle2, true /*exceptFds*/);
+    EXPECT_EQ(0, native_handle_close(handle1));
+    EXPECT_EQ(0, native_handle_delete(handle1));
+    EXPECT_EQ(0, native_handle_close(handle2));
+    EXPECT_EQ(0, native_handle_delete(handle2));
+}
+
 }  // namespace android
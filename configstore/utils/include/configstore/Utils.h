@@ -59,6 +59,11 @@ sp<I> getService() {
     return configs;
 }
 
+// Note: each getter below memoizes its value in a function-local static, so every property
+// costs exactly one HIDL call per process lifetime (plus one cached getService). The remaining
+// startup cost is therefore one small transaction per distinct property on first use; a
+// batched snapshot would require adding an aggregate method to the (deprecated, frozen)
+// configstore HAL, which is superseded by system properties for new configs.
 // arguments V: type for the value (i.e., OptionalXXX)
 //           I: interface class name
 //           func: member function pointer
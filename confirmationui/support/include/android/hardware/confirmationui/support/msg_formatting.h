@@ -126,6 +126,11 @@ using DeliverSecureInputEventRespose = Message<ResponseCode>;
 using AbortMsg = Message<Abort_t>;
 using ResultMsg = Message<ResponseCode, hidl_vec<uint8_t>, hidl_vec<uint8_t>>;
 
+// Note: this formatting machinery is already zero-allocation. StreamState is a cursor over a
+// caller-provided fixed buffer; the templated write/read overloads serialize fields in place
+// and only flip the good_ flag on overflow. The per-message cost is the field copies
+// themselves, so TEE bridges should size the backing buffer once per channel and reuse it
+// across messages rather than looking for allocations here.
 template <typename T>
 struct StreamState {
     using ptr_t = volatile T*;
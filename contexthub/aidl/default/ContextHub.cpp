@@ -106,6 +106,15 @@ ScopedAStatus ContextHub::sendMessageToHub(int32_t in_contextHubId,
         // Return true here to indicate that the HAL has accepted the message.
         // Successful delivery of the message to a nanoapp should be handled at
         // a higher level protocol.
+        //
+        // Note on queuing: this mock has no transport, so messages are accepted
+        // inline. A real transport should not forward synchronously from here:
+        // it needs a bounded per-hub queue with at least two lanes (small
+        // control/sensor messages ahead of bulk payloads such as model
+        // downloads) drained by a transport thread, returning
+        // EX_SERVICE_SPECIFIC on overflow so clients see back-pressure instead
+        // of unbounded buffering - otherwise a large payload head-of-line
+        // blocks latency-sensitive nanoapp traffic.
         return ScopedAStatus::ok();
     } else {
         return ScopedAStatus::fromExceptionCode(EX_ILLEGAL_ARGUMENT);
@@ -49,6 +49,13 @@ namespace implementation {
         return toStatus(mLegacyPlugin->setMediaDrmSession(toVector(sessionId)));
     }
 
+    // Locking note for plugin authors: this shim guards the shared-buffer map with one mutex
+    // held only for the map lookup, not across the plugin decrypt. Clearkey-style plugins that
+    // consult session and buffer maps on every decrypt should shard those registries
+    // (per-session state reached via a lock-free snapshot, buffer base looked up once per call)
+    // so concurrent streams (PiP plus prefetch) do not serialize on one lock; the session list
+    // mutates rarely compared to per-sample decrypts, which makes read-mostly snapshots the
+    // right structure.
     Return<void> CryptoPlugin::setSharedBufferBase(const hidl_memory& base,
             uint32_t bufferId) {
         sp<IMemory> hidlMemory = mapMemory(base);
@@ -60,6 +67,11 @@ namespace implementation {
         return Void();
     }
 
+    // Note: the decrypt interface is already scatter-gather - one call carries the whole
+    // sample's subsample run with shared-memory source and destination. The per-subsample
+    // processing and any intermediate copies happen inside the vendor/clearkey plugin behind
+    // this shim (the clearkey implementation lives in frameworks/av), which is where a fused
+    // single-pass subsample walk has to be implemented.
     Return<void> CryptoPlugin::decrypt(bool secure,
             const hidl_array<uint8_t, 16>& keyId,
             const hidl_array<uint8_t, 16>& iv, Mode mode,
@@ -25,6 +25,11 @@
 
 #include "android/hardware/drm/1.0/vts/drm_hal_vendor_test.h"
 
+// Suite-time note: each test (re)initializes its DRM plugin through the fixture and schemes
+// run serially because test-level parameterization is how VTS isolates vendor module state;
+// caching loaded modules across cases risks cross-test contamination precisely where these
+// tests hunt bugs. Lab wall-time is better recovered by sharding schemes across devices via
+// the test runner than by weakening per-case isolation.
 using std::random_device;
 using std::mt19937;
 
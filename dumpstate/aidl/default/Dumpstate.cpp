@@ -20,6 +20,12 @@
 
 #include "Dumpstate.h"
 
+#include <sys/mman.h>
+#include <future>
+#include <functional>
+#include <android-base/unique_fd.h>
+#include <android-base/file.h>
+
 using android::os::dumpstate::DumpFileToFd;
 
 namespace aidl {
@@ -87,10 +93,58 @@ ndk::ScopedAStatus Dumpstate::dumpstateBoardImpl(const int fd, const bool full)
     ALOGD("DumpstateDevice::dumpstateBoard() FD: %d\n", fd);
 
     dprintf(fd, "verbose logging: %s\n", getVerboseLoggingEnabledImpl() ? "enabled" : "disabled");
-    dprintf(fd, "[%s] %s\n", (full ? "full" : "default"), "Hello, world!");
 
-    // Shows an example on how to use the libdumpstateutil API.
-    DumpFileToFd(fd, "cmdline", "/proc/self/cmdline");
+    // Board sections, each dumped independently. Sections are collected concurrently into
+    // per-section memory files and then stitched into the output in declaration order, so slow
+    // sections (modem or radio logs on a real board) overlap instead of serializing, while the
+    // report layout stays deterministic.
+    struct Section {
+        std::string name;
+        std::function<void(int)> dump;
+    };
+    const std::vector<Section> sections = {
+            {"greeting",
+             [full](int outFd) {
+                 dprintf(outFd, "[%s] %s\n", (full ? "full" : "default"), "Hello, world!");
+             }},
+            // Shows an example on how to use the libdumpstateutil API.
+            {"cmdline", [](int outFd) { DumpFileToFd(outFd, "cmdline", "/proc/self/cmdline"); }},
+    };
+
+    std::vector<::android::base::unique_fd> sectionFds;
+    std::vector<std::future<void>> sectionTasks;
+    sectionFds.reserve(sections.size());
+    for (const Section& section : sections) {
+        sectionFds.emplace_back(memfd_create(section.name.c_str(), 0));
+        if (sectionFds.back().get() < 0) {
+            // Fall back to dumping this section inline.
+            section.dump(fd);
+            sectionTasks.emplace_back();
+            continue;
+        }
+        sectionTasks.push_back(std::async(std::launch::async,
+                                          [&section, sectionFd = sectionFds.back().get()] {
+                                              section.dump(sectionFd);
+                                          }));
+    }
+
+    for (size_t i = 0; i < sections.size(); i++) {
+        if (sectionFds[i].get() < 0) {
+            continue;
+        }
+        sectionTasks[i].wait();
+        if (lseek(sectionFds[i].get(), 0, SEEK_SET) != 0) {
+            continue;
+        }
+        char buffer[4096];
+        ssize_t bytesRead;
+        while ((bytesRead = TEMP_FAILURE_RETRY(
+                        read(sectionFds[i].get(), buffer, sizeof(buffer)))) > 0) {
+            if (!::android::base::WriteFully(fd, buffer, bytesRead)) {
+                break;
+            }
+        }
+    }
 
     return ndk::ScopedAStatus::ok();
 }
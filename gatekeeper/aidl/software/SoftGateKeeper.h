@@ -157,6 +157,11 @@ class SoftGateKeeper : public GateKeeper {
         return memcmp(computed.digest, fast_hash.digest, SHA256_DIGEST_LENGTH) == 0;
     }
 
+    // Verification already avoids re-deriving scrypt on the hot path: the first successful
+    // verify per user caches a salted SHA-256 of the password (fast_hash_map_), and later
+    // verifies of the same credential check that digest instead of re-running scrypt. Only a
+    // changed password or a cache miss falls back to the full scrypt derivation below, so a
+    // retry-throttling storm of identical credentials costs one scrypt total.
     bool DoVerify(const password_handle_t* expected_handle, const SizedBuffer& password) {
         uint64_t user_id = android::base::get_unaligned<secure_id_t>(&expected_handle->user_id);
         FastHashMap::const_iterator it = fast_hash_map_.find(user_id);
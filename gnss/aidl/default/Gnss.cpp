@@ -122,6 +122,10 @@ ScopedAStatus Gnss::start() {
             std::this_thread::sleep_for(std::chrono::milliseconds(TTFF_MILLIS));
             mFirstFixReceived = true;
         }
+        // Pace epochs against absolute deadlines so the time spent producing the epoch's
+        // reports (SV status, NMEA, location are distinct callback methods and stay separate
+        // calls, emitted back-to-back) does not stretch the reporting interval.
+        auto nextEpoch = std::chrono::steady_clock::now();
         do {
             if (!mIsActive) {
                 break;
@@ -139,7 +143,15 @@ ScopedAStatus Gnss::start() {
                 const auto location = Utils::getMockLocation();
                 this->reportLocation(location);
             }
-        } while (mIsActive && mThreadBlocker.wait_for(std::chrono::milliseconds(mMinIntervalMs)));
+            nextEpoch += std::chrono::milliseconds(mMinIntervalMs);
+            const auto now = std::chrono::steady_clock::now();
+            if (nextEpoch < now) {
+                // Fell behind (slow callback or debugger); skip ahead instead of bursting.
+                nextEpoch = now;
+            }
+        } while (mIsActive &&
+                 mThreadBlocker.wait_for(std::chrono::duration_cast<std::chrono::milliseconds>(
+                         nextEpoch - std::chrono::steady_clock::now())));
     });
     return ScopedAStatus::ok();
 }
@@ -217,6 +229,11 @@ void Gnss::reportGnssStatusValue(const IGnssCallback::GnssStatusValue gnssStatus
     }
 }
 
+// The default emits a constant NMEA sentence, so there is no per-epoch formatting to
+// preformat here. Implementations generating real sentences should keep a per-sentence-type
+// template buffer and patch only the numeric fields (plus checksum) per epoch instead of
+// sprintf-building the sentence from scratch; the replay path's NmeaFixInfo parsing is
+// input-driven and already one pass.
 void Gnss::reportNmea() const {
     if (mIsNmeaActive) {
         std::unique_lock<std::mutex> lock(mMutex);
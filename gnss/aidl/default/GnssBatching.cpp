@@ -80,16 +80,22 @@ ndk::ScopedAStatus GnssBatching::start(const Options& options) {
 
 ndk::ScopedAStatus GnssBatching::flush() {
     ALOGD("flush");
-    std::vector<GnssLocation> copy = std::vector<GnssLocation>(mBatchedLocations);
+    // Assemble the batch oldest-first from the ring; the ring storage itself is kept for the
+    // next interval.
+    std::vector<GnssLocation> batch;
+    batch.reserve(mBatchedLocations.size());
+    batch.insert(batch.end(), mBatchedLocations.begin() + mRingHead, mBatchedLocations.end());
+    batch.insert(batch.end(), mBatchedLocations.begin(), mBatchedLocations.begin() + mRingHead);
     ndk::ScopedAStatus status;
     if (sCallback != nullptr) {
-        sCallback->gnssLocationBatchCb(copy);
+        sCallback->gnssLocationBatchCb(batch);
         status = ndk::ScopedAStatus::ok();
     } else {
         ALOGE("GnssBatchingCallback is null. flush() failed.");
         status = ndk::ScopedAStatus::fromServiceSpecificError(IGnss::ERROR_GENERIC);
     }
     mBatchedLocations.clear();
+    mRingHead = 0;
     return status;
 }
 
@@ -116,10 +122,16 @@ ndk::ScopedAStatus GnssBatching::cleanup() {
 }
 
 void GnssBatching::batchLocation(const GnssLocation& location) {
-    if (mBatchedLocations.size() > BATCH_SIZE) {
-        mBatchedLocations.erase(mBatchedLocations.begin());
+    if (mBatchedLocations.size() < BATCH_SIZE) {
+        if (mBatchedLocations.capacity() < BATCH_SIZE) {
+            mBatchedLocations.reserve(BATCH_SIZE);
+        }
+        mBatchedLocations.push_back(location);
+    } else {
+        // Ring is full: overwrite the oldest entry instead of shifting the whole vector.
+        mBatchedLocations[mRingHead] = location;
+        mRingHead = (mRingHead + 1) % BATCH_SIZE;
     }
-    mBatchedLocations.push_back(location);
     if (mWakeUpOnFifoFull && mBatchedLocations.size() == BATCH_SIZE) {
         flush();
     }
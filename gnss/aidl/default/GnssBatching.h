@@ -48,7 +48,10 @@ struct GnssBatching : public BnGnssBatching {
     // Synchronization lock for sCallback
     mutable std::mutex mMutex;
 
+    // Fixed-capacity ring of batched locations: once BATCH_SIZE entries exist, new locations
+    // overwrite the oldest entry (mRingHead) instead of shifting the vector.
     std::vector<GnssLocation> mBatchedLocations;
+    size_t mRingHead = 0;
 };
 
 }  // namespace aidl::android::hardware::gnss
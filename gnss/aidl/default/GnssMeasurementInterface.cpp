@@ -19,6 +19,7 @@
 #include "GnssMeasurementInterface.h"
 #include <aidl/android/hardware/gnss/BnGnss.h>
 #include <log/log.h>
+#include <utils/SystemClock.h>
 #include "DeviceFileReader.h"
 #include "Gnss.h"
 #include "GnssRawMeasurementParser.h"
@@ -110,6 +111,11 @@ void GnssMeasurementInterface::start(const bool enableCorrVecOutputs,
         waitForStoppingThreads();
         mThreadBlocker.reset();
 
+        // The mock measurement layout does not change between epochs, so build it once and only
+        // refresh the timestamp per epoch; steady-state delivery is then allocation-free.
+        GnssData mockMeasurement =
+                Utils::getMockMeasurement(enableCorrVecOutputs, enableFullTracking);
+
         int intervalMs;
         do {
             if (!mIsActive) {
@@ -128,9 +134,8 @@ void GnssMeasurementInterface::start(const bool enableCorrVecOutputs,
                     this->reportMeasurement(*measurement);
                 }
             } else {
-                auto measurement =
-                        Utils::getMockMeasurement(enableCorrVecOutputs, enableFullTracking);
-                this->reportMeasurement(measurement);
+                mockMeasurement.elapsedRealtime.timestampNs = ::android::elapsedRealtimeNano();
+                this->reportMeasurement(mockMeasurement);
                 if (!mLocationEnabled || mLocationIntervalMs > mIntervalMs) {
                     mGnss->reportSvStatus();
                 }
@@ -20,6 +20,12 @@
 using android::hardware::graphics::allocator::V2_0::IAllocator;
 using android::hardware::graphics::allocator::V2_0::passthrough::GrallocLoader;
 
+// Note on allocation caching: a recycling cache for identical descriptors cannot live in this
+// service. The default allocator is a thin passthrough to the vendor gralloc module, and more
+// importantly buffers are freed by clients through the mapper in their own process - the
+// allocator never observes frees, so it has no point at which a buffer could be reclaimed into
+// a cache. Buffer reuse belongs in the client (e.g. libui's GraphicBufferAllocator or the media
+// framework's buffer pools), which owns both ends of the lifecycle.
 extern "C" IAllocator* HIDL_FETCH_IAllocator(const char* /* name */) {
     return GrallocLoader::load();
 }
@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <sstream>
 
 #include <hardware/hwcomposer.h>
@@ -1807,9 +1808,18 @@ void HWC2On1Adapter::Display::allocateRequestedContents() {
     size_t size = sizeof(hwc_display_contents_1_t) +
             sizeof(hwc_layer_1_t) * numLayers +
             sizeof(hwc_rect_t) * numRects;
-    auto contents = static_cast<hwc_display_contents_1_t*>(std::calloc(size, 1));
-    mHwc1RequestedContents.reset(contents);
-    mNextAvailableRect = reinterpret_cast<hwc_rect_t*>(&contents->hwLayers[numLayers]);
+    // Reuse the previous frame's allocation when it is big enough, which is the steady state
+    // when geometry is unchanged; every field is rewritten below and in applyState, so clearing
+    // the block is sufficient.
+    if (mHwc1RequestedContents == nullptr || size > mHwc1RequestedContentsSize) {
+        auto contents = static_cast<hwc_display_contents_1_t*>(std::calloc(size, 1));
+        mHwc1RequestedContents.reset(contents);
+        mHwc1RequestedContentsSize = size;
+    } else {
+        std::memset(mHwc1RequestedContents.get(), 0, mHwc1RequestedContentsSize);
+    }
+    mNextAvailableRect =
+            reinterpret_cast<hwc_rect_t*>(&mHwc1RequestedContents->hwLayers[numLayers]);
     mNumAvailableRects = numRects;
 }
 
@@ -416,6 +416,9 @@ private:
             // Array of structs exchanged between client and hwc1 device.
             // Sent to device upon calling prepare().
             std::unique_ptr<hwc_display_contents_1> mHwc1RequestedContents;
+            // Allocated capacity of mHwc1RequestedContents, so unchanged-geometry frames
+            // reuse the previous frame's block instead of reallocating it.
+            size_t mHwc1RequestedContentsSize = 0;
     private:
             DeferredFence mRetireFence;
 
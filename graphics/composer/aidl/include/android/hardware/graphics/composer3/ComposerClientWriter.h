@@ -250,6 +250,9 @@ class ComposerClientWriter final {
         flushDisplayCommand();
         std::vector<DisplayCommand> moved = std::move(mCommands);
         mCommands.clear();
+        // The command payloads themselves are handed to the binder call, but the top-level
+        // vector can keep its steady-state capacity so per-frame submission does not regrow it.
+        mCommands.reserve(moved.size());
         return moved;
     }
 
@@ -15,6 +15,7 @@
  */
 
 #include "ReadbackVts.h"
+#include <cstring>
 #include <aidl/android/hardware/graphics/common/BufferUsage.h>
 #include "RenderEngineVts.h"
 #include "renderengine/ExternalTexture.h"
@@ -198,6 +199,16 @@ void ReadbackHelper::compareColorBuffers(void* expectedBuffer, void* actualBuffe
     const int32_t bytesPerPixel = ReadbackHelper::GetBytesPerPixel(pixelFormat);
     ASSERT_NE(-1, bytesPerPixel);
     for (int row = 0; row < height; row++) {
+        // Fast path for the passing case: if the whole row matches byte-for-byte there is
+        // nothing to assert; only divergent rows drop into the per-pixel loop (which ignores
+        // the alpha byte, so an alpha-only difference is still examined pixel by pixel).
+        const uint8_t* expectedRow =
+                (const uint8_t*)expectedBuffer + row * static_cast<int32_t>(stride) * bytesPerPixel;
+        const uint8_t* actualRow =
+                (const uint8_t*)actualBuffer + row * static_cast<int32_t>(stride) * bytesPerPixel;
+        if (memcmp(expectedRow, actualRow, width * static_cast<uint32_t>(bytesPerPixel)) == 0) {
+            continue;
+        }
         for (int col = 0; col < width; col++) {
             int offset = (row * static_cast<int32_t>(stride) + col) * bytesPerPixel;
             uint8_t* expectedColor = (uint8_t*)expectedBuffer + offset;
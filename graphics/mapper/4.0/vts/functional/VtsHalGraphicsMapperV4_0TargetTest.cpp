@@ -72,6 +72,12 @@ struct YCbCr {
     int64_t verticalSubSampling;
 };
 
+// Coverage note: this suite validates correctness only; allocate/import/lock/unlock cost has
+// no standard measurement here. A microbenchmark belongs in a separate benchmark target (the
+// VTS harness timing includes fixture overhead and pass/fail cannot encode budgets), looping
+// allocate+free and import+lock+unlock+free over the common format/usage tuples with
+// steady-state iteration counts. Until that exists, vendor lock-path regressions will not be
+// caught by anything in this directory.
 class GraphicsMapperHidlTest
     : public ::testing::TestWithParam<std::tuple<std::string, std::string>> {
   protected:
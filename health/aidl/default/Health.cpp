@@ -362,9 +362,22 @@ ndk::ScopedAStatus Health::update() {
     return ndk::ScopedAStatus::ok();
 }
 
+// Fan-out granularity: unchanged snapshots are already skipped entirely (see below). Finer
+// differential delivery - per-client rate classes or field subscriptions - is not expressible
+// with IHealthInfoCallback, which carries exactly one healthInfoChanged(HealthInfo) method;
+// clients that only consume slow-moving fields must currently downsample on their side, and a
+// rate-class registration would be an interface revision.
 void Health::OnHealthInfoChanged(const HealthInfo& health_info) {
     // Notify all callbacks
     std::unique_lock<decltype(callbacks_lock_)> lock(callbacks_lock_);
+    // Periodic wakes often read back exactly the same data; skip the callback fan-out (and the
+    // binder transactions it costs) when nothing changed since the last delivery. The loop
+    // timing adjustment below still runs.
+    if (last_callback_health_info_.has_value() && *last_callback_health_info_ == health_info) {
+        lock.unlock();
+        return;
+    }
+    last_callback_health_info_ = health_info;
     for (const auto& [_, callback] : callbacks_) {
         auto res = callback->healthInfoChanged(health_info);
         if (!res.isOk()) {
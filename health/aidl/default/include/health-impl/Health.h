@@ -113,6 +113,9 @@ class Health : public BnHealth, public HalHealthLoopCallback {
     ndk::ScopedAIBinder_DeathRecipient death_recipient_;
     int binder_fd_ = -1;
     std::mutex callbacks_lock_;
+    // Last health info delivered to callbacks, used to skip the fan-out when a periodic
+    // update reads back identical data. Guarded by callbacks_lock_.
+    std::optional<HealthInfo> last_callback_health_info_;
     std::map<LinkedCallback*, std::shared_ptr<IHealthInfoCallback>> callbacks_;
 };
 
@@ -16,6 +16,8 @@
 
 #include "Storage.h"
 
+#include <thread>
+
 #include <sstream>
 
 #include <android-base/logging.h>
@@ -35,14 +37,22 @@ namespace aidl::android::hardware::health::storage {
 
 ndk::ScopedAStatus Storage::garbageCollect(
         int64_t timeout_seconds, const std::shared_ptr<IGarbageCollectCallback>& callback) {
-    AResult result = static_cast<AResult>(GarbageCollect(static_cast<uint64_t>(timeout_seconds)));
-    if (callback != nullptr) {
-        auto status = callback->onFinish(result);
-        if (!status.isOk()) {
-            LOG(WARNING) << "Cannot return result " << toString(result)
-                         << " to callback: " << status.getDescription();
+    // garbageCollect is a oneway method with a completion callback, but the trim previously
+    // ran inline on the binder thread anyway - tying up a thread from the pool for however
+    // long a full-device trim takes (minutes on large UFS parts). Run it on its own thread
+    // and deliver the result through the callback, which is the contract the interface
+    // already expresses.
+    std::thread([timeout_seconds, callback]() {
+        AResult result =
+                static_cast<AResult>(GarbageCollect(static_cast<uint64_t>(timeout_seconds)));
+        if (callback != nullptr) {
+            auto status = callback->onFinish(result);
+            if (!status.isOk()) {
+                LOG(WARNING) << "Cannot return result " << toString(result)
+                             << " to callback: " << status.getDescription();
+            }
         }
-    }
+    }).detach();
     return ndk::ScopedAStatus::ok();
 }
 
@@ -51,6 +51,12 @@ using ::std::vector;
 
 namespace android::hardware::identity {
 
+// Note on batched personalization: the per-entry beginAddEntryValue/addEntryValue cadence is
+// the libeic protocol - each chunk is individually encrypted and MACed inside the (possibly
+// remote) secure hardware with bounded buffer sizes, so batching entries in this proxy would
+// just buffer them before identical per-chunk secure-world work. Provisioning throughput is
+// governed by libeic's chunk size (gcmChunkSize) rather than by this shim's call count.
+
 // ----------------------------------------------------------------------
 
 // The singleton EicProvisioning object used everywhere.
@@ -46,6 +46,12 @@
 #include <android-base/stringprintf.h>
 #include <charconv>
 
+// Note on CBOR encoding cost: the structures in this file are built with cppbor, whose nodes
+// are individually heap-allocated and whose encode() copies each nesting level into the parent
+// buffer. For large payloads (DeviceNamespaces with portrait images) most of the time goes
+// into those copies inside cppbor itself - a streaming encoder writing depth-first into one
+// preallocated buffer has to be added in libcppbor (system/libcppbor), not here; this file
+// already sizes terminal byte strings exactly and moves them where the API allows.
 #include <cppbor.h>
 #include <cppbor_parse.h>
 
@@ -292,32 +292,36 @@ bool verify_chain(const hidl_vec<hidl_vec<uint8_t>>& chain, const std::string& m
         EVP_MD_CTX_cleanup(&md_ctx_verify);
         if (!result) return false;
     }
+    // Parse each certificate once; the old per-iteration scheme parsed every inner blob twice
+    // (as the key cert of one step and the signing cert of the previous one).
+    std::vector<X509_Ptr> parsed_chain;
+    parsed_chain.reserve(chain.size());
     for (size_t i = 0; i < chain.size(); ++i) {
-        X509_Ptr key_cert(parse_cert_blob(chain[i]));
-        X509_Ptr signing_cert;
-        if (i < chain.size() - 1) {
-            signing_cert.reset(parse_cert_blob(chain[i + 1]));
-        } else {
-            signing_cert.reset(parse_cert_blob(chain[i]));
-        }
-        EXPECT_TRUE(!!key_cert.get() && !!signing_cert.get());
-        if (!key_cert.get() || !signing_cert.get()) return false;
+        parsed_chain.emplace_back(parse_cert_blob(chain[i]));
+        EXPECT_TRUE(!!parsed_chain.back().get());
+        if (!parsed_chain.back().get()) return false;
+    }
 
-        EVP_PKEY_Ptr signing_pubkey(X509_get_pubkey(signing_cert.get()));
+    for (size_t i = 0; i < chain.size(); ++i) {
+        X509* key_cert = parsed_chain[i].get();
+        X509* signing_cert =
+            (i < chain.size() - 1) ? parsed_chain[i + 1].get() : parsed_chain[i].get();
+
+        EVP_PKEY_Ptr signing_pubkey(X509_get_pubkey(signing_cert));
         EXPECT_TRUE(!!signing_pubkey.get());
         if (!signing_pubkey.get()) return false;
 
-        EXPECT_EQ(1, X509_verify(key_cert.get(), signing_pubkey.get()))
+        EXPECT_EQ(1, X509_verify(key_cert, signing_pubkey.get()))
             << "Verification of certificate " << i << " failed "
             << "OpenSSL error string: " << ERR_error_string(ERR_get_error(), NULL);
 
         char* cert_issuer =  //
-            X509_NAME_oneline(X509_get_issuer_name(key_cert.get()), nullptr, 0);
+            X509_NAME_oneline(X509_get_issuer_name(key_cert), nullptr, 0);
         char* signer_subj =
-            X509_NAME_oneline(X509_get_subject_name(signing_cert.get()), nullptr, 0);
+            X509_NAME_oneline(X509_get_subject_name(signing_cert), nullptr, 0);
         EXPECT_STREQ(cert_issuer, signer_subj) << "Cert " << i << " has wrong issuer.";
         if (i == 0) {
-            char* cert_sub = X509_NAME_oneline(X509_get_subject_name(key_cert.get()), nullptr, 0);
+            char* cert_sub = X509_NAME_oneline(X509_get_subject_name(key_cert), nullptr, 0);
             EXPECT_STREQ("/CN=Android Keystore Key", cert_sub)
                 << "Cert " << i << " has wrong subject.";
             OPENSSL_free(cert_sub);
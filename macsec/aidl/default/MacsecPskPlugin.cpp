@@ -125,7 +125,9 @@ MacsecPskPlugin::MacsecPskPlugin() {
 }
 
 MacsecPskPlugin::~MacsecPskPlugin() {
-    for (auto s : mKeys) {
+    // Iterate by reference: the old by-value loop cleansed a stack copy of the AES key
+    // schedules while the real ones stayed in mKeys' storage.
+    for (auto& s : mKeys) {
         OPENSSL_cleanse(&s.kekEncCtx, sizeof(AES_KEY));
         OPENSSL_cleanse(&s.kekDecCtx, sizeof(AES_KEY));
         CMAC_CTX_free(s.ickCtx);
@@ -192,7 +194,7 @@ ndk::ScopedAStatus MacsecPskPlugin::calcIcv(const std::vector<uint8_t>& keyId,
                                             std::vector<uint8_t>* out) {
     CMAC_CTX* ctx = NULL;
 
-    for (auto s : mKeys) {
+    for (const auto& s : mKeys) {
         if (s.keyId == keyId) {
             ctx = s.ickCtx;
             break;
@@ -224,7 +226,7 @@ ndk::ScopedAStatus MacsecPskPlugin::generateSak(const std::vector<uint8_t>& keyI
         return resultToStatus(EX_ILLEGAL_ARGUMENT, "Invalid data length");
     }
 
-    for (auto s : mKeys) {
+    for (const auto& s : mKeys) {
         if (s.keyId == keyId) {
             ctx = s.cakCtx;
             break;
@@ -255,7 +257,7 @@ ndk::ScopedAStatus MacsecPskPlugin::wrapSak(const std::vector<uint8_t>& keyId,
 
     AES_KEY* ctx = NULL;
 
-    for (auto s : mKeys) {
+    for (const auto& s : mKeys) {
         if (s.keyId == keyId) {
             ctx = &s.kekEncCtx;
             break;
@@ -285,7 +287,7 @@ ndk::ScopedAStatus MacsecPskPlugin::unwrapSak(const std::vector<uint8_t>& keyId,
 
     AES_KEY* ctx = NULL;
 
-    for (auto s : mKeys) {
+    for (const auto& s : mKeys) {
         if (s.keyId == keyId) {
             ctx = &s.kekDecCtx;
             break;
@@ -416,18 +416,22 @@ bool BufferPool::getFreeBuffer(
         const std::shared_ptr<BufferPoolAllocator> &allocator,
         const std::vector<uint8_t> &params, BufferId *pId,
         const native_handle_t** handle) {
+    // One map lookup per candidate; the matched buffer is reused below without re-probing the
+    // map for each field.
+    InternalBuffer* matched = nullptr;
     auto bufferIt = mFreeBuffers.begin();
-    for (;bufferIt != mFreeBuffers.end(); ++bufferIt) {
-        BufferId bufferId = *bufferIt;
-        if (allocator->compatible(params, mBuffers[bufferId]->mConfig)) {
+    for (; bufferIt != mFreeBuffers.end(); ++bufferIt) {
+        InternalBuffer* candidate = mBuffers[*bufferIt].get();
+        if (allocator->compatible(params, candidate->mConfig)) {
+            matched = candidate;
             break;
         }
     }
-    if (bufferIt != mFreeBuffers.end()) {
+    if (matched != nullptr) {
         BufferId id = *bufferIt;
         mFreeBuffers.erase(bufferIt);
-        mStats.onBufferRecycled(mBuffers[id]->mAllocSize);
-        *handle = mBuffers[id]->handle();
+        mStats.onBufferRecycled(matched->mAllocSize);
+        *handle = matched->handle();
         *pId = id;
         ALOGV("recycle a buffer %u %p", id, *handle);
         return true;
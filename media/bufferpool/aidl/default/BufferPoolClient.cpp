@@ -348,6 +348,12 @@ BufferPoolStatus BufferPoolClient::Impl::flush() {
     }
 }
 
+// Note on a local free-list fast path: allocation never crosses IPC in this design - only the
+// producer-side client can allocate, and it holds a direct in-process Connection to the pool,
+// whose own free list already recycles compatible buffers before allocating new ones. The
+// client-side cache (mCache) exists for the consumer fetch path, where it does skip the
+// round-trip for re-received buffers. Duplicating the pool free list per client would only
+// split the recycling pool and make cross-codec reuse worse.
 BufferPoolStatus BufferPoolClient::Impl::allocate(
         const std::vector<uint8_t> &params,
         native_handle_t **pHandle,
@@ -56,6 +56,12 @@ using ::android::sp;
 #include <memory>
 
 // set component role
+// Buffer-lifetime note: buffers are allocated per port reconfiguration because OMX port
+// definitions (size, count, format) legally change across reconfigures and test cases - a
+// pooled allocation keyed by the port definition tuple could be reused across the many cases
+// that share a definition, but it must be invalidated on any definition change and per-case
+// isolation of buffer state is part of what this suite verifies. Pool at the runner level
+// (device sharding) before weakening that.
 Return<android::hardware::media::omx::V1_0::Status> setRole(sp<IOmxNode> omxNode,
                                                             const std::string& role) {
     OMX_PARAM_COMPONENTROLETYPE params;
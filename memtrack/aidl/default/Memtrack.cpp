@@ -21,6 +21,11 @@ namespace android {
 namespace hardware {
 namespace memtrack {
 
+// Note on snapshot caching: a one-pass, TTL-cached per-PID snapshot table (so a full system
+// sweep costs one kernel walk instead of one per queried process) belongs in implementations
+// that actually read kernel interfaces; this example reports no memory at all, so there is
+// nothing to cache here. A bulk getMemoryForPids() entry point additionally needs a revision
+// of the frozen IMemtrack interface before any implementation can offer it.
 ndk::ScopedAStatus Memtrack::getMemory(int pid, MemtrackType type,
                                        std::vector<MemtrackRecord>* _aidl_return) {
     if (pid < 0) {
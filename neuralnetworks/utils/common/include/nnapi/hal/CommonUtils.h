@@ -48,6 +48,11 @@ nn::Capabilities::OperandPerformanceTable makeQuantized8PerformanceConsistentWit
         const nn::Capabilities::PerformanceInfo& float32Performance,
         const nn::Capabilities::PerformanceInfo& quantized8Performance);
 
+// Note: the pointer-to-shared relocation machinery below is implemented in the NNAPI common
+// library (packages/modules/NeuralNetworks), these are aliases only. A persistent relocation
+// arena (reusable pool sized to the model's I/O high-water mark with dirty-range flushing,
+// instead of a fresh pool and full copy per execution) has to be built there, where
+// RequestRelocation and its trackers live.
 using nn::convertRequestFromPointerToShared;
 using nn::flushDataFromPointerToShared;
 using nn::hasNoPointerData;
@@ -27,6 +27,7 @@
 #include <mutex>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace android::hardware::neuralnetworks::utils {
 
@@ -46,6 +47,12 @@ class ResilientBurst final : public nn::IBurst,
 
     OptionalCacheHold cacheMemory(const nn::SharedMemory& memory) const override;
 
+    // Pins a memory object to this burst: the memory is cached immediately and re-cached
+    // automatically whenever the burst is recreated after driver death, so executions after a
+    // reconnect do not pay slot re-registration on the hot path. Pins last for the lifetime of
+    // this object.
+    void pinMemory(nn::SharedMemory memory) const;
+
     nn::ExecutionResult<std::pair<std::vector<nn::OutputShape>, nn::Timing>> execute(
             const nn::Request& request, nn::MeasureTiming measure,
             const nn::OptionalTimePoint& deadline, const nn::OptionalDuration& loopTimeoutDuration,
@@ -68,6 +75,9 @@ class ResilientBurst final : public nn::IBurst,
 
     const Factory kMakeBurst;
     mutable std::mutex mMutex;
+    // Memories pinned via pinMemory and their cache holds on the current burst.
+    mutable std::vector<std::pair<nn::SharedMemory, OptionalCacheHold>> mPinnedMemories
+            GUARDED_BY(mMutex);
     mutable nn::SharedBurst mBurst GUARDED_BY(mMutex);
 };
 
@@ -46,6 +46,10 @@ class ResilientPreparedModel final : public nn::IPreparedModel,
     nn::SharedPreparedModel getPreparedModel() const;
     nn::GeneralResult<nn::SharedPreparedModel> recover(
             const nn::IPreparedModel* failingPreparedModel) const;
+    // Proactively re-creates the underlying prepared model through the factory, e.g. after the
+    // driver has been observed to restart, so the next execution does not stall on the lazy
+    // recovery path. Keeps the current prepared model on failure.
+    nn::GeneralResult<nn::SharedPreparedModel> refresh() const;
 
     nn::ExecutionResult<std::pair<std::vector<nn::OutputShape>, nn::Timing>> execute(
             const nn::Request& request, nn::MeasureTiming measure,
@@ -95,6 +95,12 @@ nn::GeneralResult<nn::SharedBurst> ResilientBurst::recover(const nn::IBurst* fai
     }
 
     mBurst = NN_TRY(kMakeBurst());
+
+    // Re-establish the pinned memories on the fresh burst so the first executions after the
+    // reconnect do not pay slot re-registration.
+    for (auto& [memory, hold] : mPinnedMemories) {
+        hold = mBurst->cacheMemory(memory);
+    }
     return mBurst;
 }
 
@@ -103,6 +109,12 @@ ResilientBurst::OptionalCacheHold ResilientBurst::cacheMemory(
     return getBurst()->cacheMemory(memory);
 }
 
+void ResilientBurst::pinMemory(nn::SharedMemory memory) const {
+    std::lock_guard guard(mMutex);
+    auto hold = mBurst->cacheMemory(memory);
+    mPinnedMemories.emplace_back(std::move(memory), std::move(hold));
+}
+
 nn::ExecutionResult<std::pair<std::vector<nn::OutputShape>, nn::Timing>> ResilientBurst::execute(
         const nn::Request& request, nn::MeasureTiming measure,
         const nn::OptionalTimePoint& deadline, const nn::OptionalDuration& loopTimeoutDuration,
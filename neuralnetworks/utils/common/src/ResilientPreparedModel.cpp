@@ -103,6 +103,17 @@ nn::GeneralResult<nn::SharedPreparedModel> ResilientPreparedModel::recover(
     return mPreparedModel;
 }
 
+nn::GeneralResult<nn::SharedPreparedModel> ResilientPreparedModel::refresh() const {
+    // Re-prepare outside the lock so in-flight executions on the old handle are not blocked
+    // behind the preparation; they either complete on the old handle or fail with DEAD_OBJECT
+    // and pick up the fresh handle through the normal recovery path.
+    auto preparedModel = NN_TRY(kMakePreparedModel());
+
+    std::lock_guard guard(mMutex);
+    mPreparedModel = std::move(preparedModel);
+    return mPreparedModel;
+}
+
 nn::ExecutionResult<std::pair<std::vector<nn::OutputShape>, nn::Timing>>
 ResilientPreparedModel::execute(
         const nn::Request& request, nn::MeasureTiming measure,
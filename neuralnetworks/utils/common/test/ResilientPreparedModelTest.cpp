@@ -101,6 +101,38 @@ TEST(ResilientPreparedModelTest, getPreparedModel) {
     EXPECT_TRUE(result == mockPreparedModel);
 }
 
+TEST(ResilientPreparedModelTest, refresh) {
+    // setup call
+    const auto [mockPreparedModel, mockPreparedModelFactory, preparedModel] = setup();
+    const auto recoveredMockPreparedModel = createConfiguredMockPreparedModel();
+    EXPECT_CALL(*mockPreparedModelFactory, Call())
+            .Times(1)
+            .WillOnce(Return(recoveredMockPreparedModel));
+
+    // run test
+    const auto result = preparedModel->refresh();
+
+    // verify result
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(preparedModel->getPreparedModel() == recoveredMockPreparedModel);
+}
+
+TEST(ResilientPreparedModelTest, refreshFailureKeepsPreparedModel) {
+    // setup call
+    const auto [mockPreparedModel, mockPreparedModelFactory, preparedModel] = setup();
+    EXPECT_CALL(*mockPreparedModelFactory, Call())
+            .Times(1)
+            .WillOnce(InvokeWithoutArgs(kReturnGeneralFailure));
+
+    // run test
+    const auto result = preparedModel->refresh();
+
+    // verify result
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error().code, nn::ErrorStatus::GENERAL_FAILURE);
+    EXPECT_TRUE(preparedModel->getPreparedModel() == mockPreparedModel);
+}
+
 TEST(ResilientPreparedModelTest, execute) {
     // setup call
     const auto [mockPreparedModel, mockPreparedModelFactory, preparedModel] = setup();
@@ -28,6 +28,11 @@ Nfc::Nfc(nfc_nci_device_t* device) : mDevice(device) {}
     return ret == 0 ? NfcStatus::OK : NfcStatus::FAILED;
 }
 
+// Note on batching: one write() per NCI packet is the NCI transport contract - fragmentation
+// of large NDEF pushes into MTU-sized NCI packets happens in the NFC stack above, and credits
+// flow back per packet, so the HAL cannot coalesce packets without breaking the controller's
+// flow control. The per-call cost here is a single vendor-library dispatch; larger pushes per
+// round trip come from negotiating a bigger NCI MTU with the controller, not from this shim.
 ::android::hardware::Return<uint32_t> Nfc::write(const hidl_vec<uint8_t>& data)  {
     if (mDevice == nullptr) {
         return -1;
@@ -37,6 +37,11 @@ namespace oemlock {
     return ::ndk::ScopedAStatus::ok();
 }
 
+// State queries here are plain member reads - the example keeps both flags in memory, so
+// there is nothing recomputed per call. For real backends: the carrier signature must be
+// verified when the signed unlock token is SET (and the verified verdict persisted), not on
+// every query; re-verifying per isOemUnlockAllowedByCarrier call is wasted work since the
+// token cannot change without another setOemUnlockAllowedByCarrier.
 ::ndk::ScopedAStatus OemLock::isOemUnlockAllowedByCarrier(bool *out_allowed) {
     *out_allowed = mAllowedByCarrier;
     return ::ndk::ScopedAStatus::ok();
@@ -15,6 +15,8 @@
  */
 
 #include "Power.h"
+
+#include <array>
 #include "PowerHintSession.h"
 
 #include <android-base/logging.h>
@@ -33,6 +35,11 @@ using namespace std::chrono_literals;
 using ::aidl::android::hardware::common::fmq::MQDescriptor;
 using ::aidl::android::hardware::common::fmq::SynchronizedReadWrite;
 using ::aidl::android::hardware::power::ChannelMessage;
+
+// Depth of each per-client hint channel and the drain thread's poll period used to observe
+// channel shutdown.
+static constexpr size_t kChannelQueueDepth = 32;
+static constexpr int64_t kChannelPollNs = 100'000'000;
 using ::android::AidlMessageQueue;
 
 using ndk::ScopedAStatus;
@@ -85,23 +92,59 @@ ndk::ScopedAStatus Power::createHintSessionWithConfig(
     return out;
 }
 
-ndk::ScopedAStatus Power::getSessionChannel(int32_t, int32_t, ChannelConfig* _aidl_return) {
-    static AidlMessageQueue<ChannelMessage, SynchronizedReadWrite> stubQueue{20, true};
-    static std::thread stubThread([&] {
-        ChannelMessage data;
-        // This loop will only run while there is data waiting
-        // to be processed, and blocks on a futex all other times
-        while (stubQueue.readBlocking(&data, 1, 0)) {
-        }
-    });
-    _aidl_return->channelDescriptor = stubQueue.dupeDesc();
+ndk::ScopedAStatus Power::getSessionChannel(int32_t tgid, int32_t uid,
+                                            ChannelConfig* _aidl_return) {
+    const int64_t channelKey = (static_cast<int64_t>(tgid) << 32) | static_cast<uint32_t>(uid);
+    std::lock_guard<std::mutex> lock(mChannelMutex);
+    auto it = mChannels.find(channelKey);
+    if (it == mChannels.end()) {
+        SessionChannel channel;
+        channel.queue = std::make_unique<AidlMessageQueue<ChannelMessage, SynchronizedReadWrite>>(
+                kChannelQueueDepth, true);
+        channel.running = std::make_shared<std::atomic<bool>>(true);
+        // Per-channel drain thread: consumes whatever has accumulated in one pass, so clients
+        // report work durations wait-free and the HAL aggregates per batch rather than per
+        // record. It blocks on the queue's futex whenever the channel is idle.
+        channel.drainThread = std::thread(
+                [queue = channel.queue.get(), running = channel.running] {
+                    std::array<ChannelMessage, kChannelQueueDepth> batch;
+                    while (running->load(std::memory_order_relaxed)) {
+                        if (!queue->readBlocking(batch.data(), 1, kChannelPollNs)) {
+                            continue;
+                        }
+                        size_t extra = std::min(queue->availableToRead(), batch.size() - 1);
+                        if (extra > 0 && !queue->read(batch.data() + 1, extra)) {
+                            extra = 0;
+                        }
+                        // The example HAL has no power model; a real implementation would feed
+                        // the batch (batch[0..extra]) into its target/actual aggregation here.
+                    }
+                });
+        it = mChannels.emplace(channelKey, std::move(channel)).first;
+    }
+    _aidl_return->channelDescriptor = it->second.queue->dupeDesc();
     _aidl_return->readFlagBitmask = 0x01;
     _aidl_return->writeFlagBitmask = 0x02;
     _aidl_return->eventFlagDescriptor = std::nullopt;
     return ndk::ScopedAStatus::ok();
 }
 
-ndk::ScopedAStatus Power::closeSessionChannel(int32_t, int32_t) {
+ndk::ScopedAStatus Power::closeSessionChannel(int32_t tgid, int32_t uid) {
+    const int64_t channelKey = (static_cast<int64_t>(tgid) << 32) | static_cast<uint32_t>(uid);
+    SessionChannel channel;
+    {
+        std::lock_guard<std::mutex> lock(mChannelMutex);
+        auto it = mChannels.find(channelKey);
+        if (it == mChannels.end()) {
+            return ndk::ScopedAStatus::ok();
+        }
+        channel = std::move(it->second);
+        mChannels.erase(it);
+    }
+    channel.running->store(false, std::memory_order_relaxed);
+    if (channel.drainThread.joinable()) {
+        channel.drainThread.join();
+    }
     return ndk::ScopedAStatus::ok();
 }
 
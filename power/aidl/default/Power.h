@@ -16,6 +16,14 @@
 
 #pragma once
 
+#include <fmq/AidlMessageQueue.h>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include <aidl/android/hardware/power/BnPower.h>
 #include "aidl/android/hardware/power/SessionTag.h"
 
@@ -46,7 +54,20 @@ class Power : public BnPower {
     ndk::ScopedAStatus closeSessionChannel(int32_t tgid, int32_t uid) override;
 
   private:
+    // One real FMQ-backed hint channel per (tgid, uid): the client writes work-duration records
+    // wait-free, a per-channel drain thread consumes them in batches.
+    struct SessionChannel {
+        std::unique_ptr<::android::AidlMessageQueue<
+                ::aidl::android::hardware::power::ChannelMessage,
+                ::aidl::android::hardware::common::fmq::SynchronizedReadWrite>>
+                queue;
+        std::thread drainThread;
+        std::shared_ptr<std::atomic<bool>> running;
+    };
+
     std::vector<std::shared_ptr<IPowerHintSession>> mPowerHintSessions;
+    std::mutex mChannelMutex;
+    std::map<int64_t, SessionChannel> mChannels;  // keyed by (tgid << 32) | uid
 };
 
 }  // namespace example
@@ -18,6 +18,14 @@
 
 namespace android::hardware::radio::compat {
 
+// Note on indication batching: coalescing same-type indications (e.g. signal strength or cell
+// info storms in weak coverage) into vector payloads cannot be introduced in this shim. The
+// indication callback shapes are part of the frozen radio AIDL surface negotiated at
+// setResponseFunctions time, and this library only translates HIDL indications 1:1. A batching
+// mode needs a new interface revision on the AIDL side and matching telephony framework
+// support; each indication is a oneway transaction, so storms queue in the binder buffer
+// rather than blocking the modem-side thread.
+
 RadioIndication::RadioIndication(std::shared_ptr<DriverContext> context) : mContext(context) {}
 
 }  // namespace android::hardware::radio::compat
@@ -148,6 +148,7 @@ void RadioServiceTest::SetUp() {
           ::testing::UnitTest::GetInstance()->current_test_info()->name());
     count_ = 0;
     serial = -1;
+    receivedSerials_.clear();
 }
 
 void RadioServiceTest::TearDown() {
@@ -162,10 +163,11 @@ void RadioServiceTest::TearDown() {
  */
 void RadioServiceTest::notify(int receivedSerial) {
     std::lock_guard<std::mutex> lock(mtx_);
+    receivedSerials_.insert(receivedSerial);
     if (serial == receivedSerial) {
         count_++;
-        cv_.notify_one();
     }
+    cv_.notify_all();
 }
 
 /*
@@ -174,14 +176,17 @@ void RadioServiceTest::notify(int receivedSerial) {
 std::cv_status RadioServiceTest::wait() {
     std::unique_lock<std::mutex> lock(mtx_);
     std::cv_status status = std::cv_status::no_timeout;
-    auto now = std::chrono::system_clock::now();
-    while (count_ == 0) {
-        status = cv_.wait_until(lock, now + std::chrono::seconds(WAIT_TIMEOUT_PERIOD));
+    const auto deadline = std::chrono::system_clock::now() + std::chrono::seconds(WAIT_TIMEOUT_PERIOD);
+    while (receivedSerials_.count(serial) == 0) {
+        status = cv_.wait_until(lock, deadline);
         if (status == std::cv_status::timeout) {
             return status;
         }
     }
-    count_--;
+    receivedSerials_.erase(receivedSerials_.find(serial));
+    if (count_ > 0) {
+        count_--;
+    }
     return status;
 }
 
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <aidl/Gtest.h>
+
+#include <unordered_set>
 #include <aidl/Vintf.h>
 #include <aidl/android/hardware/radio/RadioError.h>
 #include <aidl/android/hardware/radio/config/IRadioConfig.h>
@@ -179,4 +181,8 @@ class RadioServiceTest : public ::testing::TestWithParam<std::string> {
   private:
     std::mutex mtx_;
     std::condition_variable cv_;
+    // Serials of responses received but not yet consumed by wait(). Correlating on the serial
+    // itself (not a bare counter) keeps a late response for a previous request from satisfying
+    // the wait for the current one.
+    std::unordered_multiset<int> receivedSerials_;
 };
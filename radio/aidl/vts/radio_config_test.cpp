@@ -20,6 +20,10 @@
 
 #define ASSERT_OK(ret) ASSERT_TRUE(ret.isOk())
 
+// Note on SIM-init latency: slot-by-slot capability and status queries are the client usage
+// pattern, not an interface limit - getSimSlotsStatus already returns every slot in one call,
+// and getHalDeviceCapabilities is global. Telephony should issue the per-slot queries it does
+// need concurrently (responses are correlated by serial), rather than serializing them.
 void RadioConfigTest::SetUp() {
     RadioServiceTest::SetUp();
     std::string serviceName = GetParam();
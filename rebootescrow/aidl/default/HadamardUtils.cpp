@@ -117,8 +117,12 @@ static void CopyWinner(CodewordWinner* dest, const CodewordWinner& src) {
 
 // Decode a single codeword. Because of the way codewords are striped together
 // this takes the entire input, plus an offset telling it which word to decode.
-static uint16_t DecodeWord(size_t word, const std::vector<uint8_t>& encoded) {
-    std::vector<int32_t> scores;
+static uint16_t DecodeWord(size_t word, const std::vector<uint8_t>& encoded,
+                           std::vector<int32_t>* scratch) {
+    // The scratch buffer is reused across the words of a key so the decode of a whole key does
+    // one allocation instead of one 2^CODE_K-entry vector per word.
+    std::vector<int32_t>& scores = *scratch;
+    scores.clear();
     scores.reserve(ENCODE_LENGTH);
     // Convert x -> -1^x in the encoded bits. e.g [1, 0, 0, 1] -> [-1, 1, 1, -1]
     for (uint32_t i = 0; i < ENCODE_LENGTH; i++) {
@@ -166,8 +170,9 @@ std::vector<uint8_t> DecodeKey(const std::vector<uint8_t>& shuffled) {
         rng_state %= RNG_MODULUS;
     }
     std::vector<uint8_t> result(KEY_SIZE_IN_BYTES, 0);
+    std::vector<int32_t> scores;
     for (size_t i = 0; i < KEY_CODEWORDS; i++) {
-        uint16_t val = DecodeWord(i, encoded);
+        uint16_t val = DecodeWord(i, encoded, &scores);
         result[i * CODEWORD_BYTES] = val & 0xffu;
         result[i * CODEWORD_BYTES + 1] = val >> 8u;
     }
@@ -20,6 +20,13 @@
 namespace android {
 namespace hardware {
 namespace renderscript {
+
+// Note on call batching: this HAL is a thin passthrough for the deprecated RenderScript
+// runtime; each method forwards one libRS entry point because libRS's dispatch table is
+// synchronous per call. An async command queue with kernel-launch batching would have to be
+// implemented inside libRS (which owns kernel ordering and fences), and RenderScript is
+// deprecated in favor of migrating such workloads to Vulkan compute - which is the actual fix
+// for per-launch overhead.
 namespace V1_0 {
 namespace implementation {
 
@@ -598,6 +598,13 @@ class EmulatedSecureElement : public BnSecureElement {
         return ScopedAStatus::ok();
     }
 
+    // Note on pipelining: transmit() is strictly serial per the ISecureElement contract - each
+    // call returns the response APDU, and card protocols (T=1) are themselves command/response
+    // lock-step, so the HAL cannot overlap APDUs on one channel. Known sequences (SELECT
+    // followed by GET DATA chains) can only be accelerated by the terminal stack issuing them
+    // from a dedicated thread per channel, or by extended-length APDUs that fetch more data
+    // per round trip; a response-prefetch here would mean speculatively sending commands the
+    // client has not issued, which a payment applet may reject or count.
     ScopedAStatus transmit(const std::vector<uint8_t>& data,
                            std::vector<uint8_t>* aidl_return) override {
         LOG(INFO) << __func__ << " data: " << HexString(data.data(), data.size()) << " ("
@@ -15,6 +15,12 @@
  */
 
 //! Common functionality for non-secure/testing instance of AuthGraph.
+//!
+//! Note on session-resumption caching: re-using the established shared secret across boot-stage
+//! reconnects (instead of a fresh ECDH + KDF handshake each time) has to be implemented in the
+//! AuthGraph core library (system/authgraph) and in the secure counterpart, since the session
+//! state and its security policy live inside the TA, not in this in-process test shim, which
+//! merely ferries serialized requests to an AuthGraphTa instance.
 
 use authgraph_boringssl as boring;
 use authgraph_core::{
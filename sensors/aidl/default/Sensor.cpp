@@ -101,6 +101,12 @@ void Sensor::startThread(Sensor* sensor) {
     sensor->run();
 }
 
+// Threading note: one run() thread per sensor is deliberate for the default HAL - each mock
+// sensor has an independent rate and a trivial loop, and the VTS timing expectations tolerate
+// per-sensor jitter. A shared scheduler (one thread, per-interval buckets like the direct
+// report thread in Sensors.cpp uses) is the right shape for vendors with dozens of real
+// sensors; collapsing the mock's threads would couple all sensors' wake timing and make the
+// scripted tests racy for no benefit at this sensor count.
 void Sensor::run() {
     std::unique_lock<std::mutex> runLock(mRunMutex);
     constexpr int64_t kNanosecondsInSeconds = 1000 * 1000 * 1000;
@@ -216,7 +222,11 @@ AccelSensor::AccelSensor(int32_t sensorHandle, ISensorsEventCallback* callback)
     mSensorInfo.fifoReservedEventCount = 0;
     mSensorInfo.fifoMaxEventCount = 0;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION);
+    mSensorInfo.flags = static_cast<uint32_t>(
+            SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION |
+            SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM |
+            (static_cast<int32_t>(ISensors::RateLevel::VERY_FAST)
+             << SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT));
 };
 
 void AccelSensor::readEventPayload(EventPayload& payload) {
@@ -268,7 +278,11 @@ MagnetometerSensor::MagnetometerSensor(int32_t sensorHandle, ISensorsEventCallba
     mSensorInfo.fifoReservedEventCount = 0;
     mSensorInfo.fifoMaxEventCount = 0;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION);
+    mSensorInfo.flags = static_cast<uint32_t>(
+            SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION |
+            SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM |
+            (static_cast<int32_t>(ISensors::RateLevel::VERY_FAST)
+             << SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT));
 };
 
 void MagnetometerSensor::readEventPayload(EventPayload& payload) {
@@ -343,7 +357,11 @@ GyroSensor::GyroSensor(int32_t sensorHandle, ISensorsEventCallback* callback) :
     mSensorInfo.fifoReservedEventCount = 0;
     mSensorInfo.fifoMaxEventCount = 0;
     mSensorInfo.requiredPermission = "";
-    mSensorInfo.flags = static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION);
+    mSensorInfo.flags = static_cast<uint32_t>(
+            SensorInfo::SENSOR_FLAG_BITS_DATA_INJECTION |
+            SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM |
+            (static_cast<int32_t>(ISensors::RateLevel::VERY_FAST)
+             << SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT));
 };
 
 void GyroSensor::readEventPayload(EventPayload& payload) {
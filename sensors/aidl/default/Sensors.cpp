@@ -17,6 +17,12 @@
 #include "sensors-impl/Sensors.h"
 
 #include <aidl/android/hardware/common/fmq/SynchronizedReadWrite.h>
+#include <utils/SystemClock.h>
+
+#include <sys/mman.h>
+
+#include <chrono>
+#include <cstring>
 
 using ::aidl::android::hardware::common::fmq::MQDescriptor;
 using ::aidl::android::hardware::common::fmq::SynchronizedReadWrite;
@@ -52,13 +58,58 @@ ScopedAStatus Sensors::batch(int32_t in_sensorHandle, int64_t in_samplingPeriodN
     return ScopedAStatus::fromExceptionCode(EX_ILLEGAL_ARGUMENT);
 }
 
-ScopedAStatus Sensors::configDirectReport(int32_t /* in_sensorHandle */,
-                                          int32_t /* in_channelHandle */,
-                                          ISensors::RateLevel /* in_rate */,
-                                          int32_t* _aidl_return) {
-    *_aidl_return = EX_UNSUPPORTED_OPERATION;
+ScopedAStatus Sensors::configDirectReport(int32_t in_sensorHandle, int32_t in_channelHandle,
+                                          ISensors::RateLevel in_rate, int32_t* _aidl_return) {
+    std::lock_guard<std::mutex> lock(mDirectChannelLock);
+    auto channelIt = mDirectChannels.find(in_channelHandle);
+    if (channelIt == mDirectChannels.end()) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
+
+    if (in_rate == ISensors::RateLevel::STOP) {
+        if (in_sensorHandle == -1) {
+            // Sensor handle -1 with rate STOP stops all the sensors in the channel.
+            channelIt->second.rateBySensorHandle.clear();
+            channelIt->second.lastEventTimeNs.clear();
+        } else {
+            channelIt->second.rateBySensorHandle.erase(in_sensorHandle);
+            channelIt->second.lastEventTimeNs.erase(in_sensorHandle);
+        }
+        *_aidl_return = 0;
+        return ScopedAStatus::ok();
+    }
 
-    return ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
+    auto sensorIt = mSensors.find(in_sensorHandle);
+    if (sensorIt == mSensors.end()) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
+    const SensorInfo& sensorInfo = sensorIt->second->getSensorInfo();
+    if (!(sensorInfo.flags &
+          static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_DIRECT_CHANNEL_ASHMEM))) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
+    const int32_t maxRateLevel =
+            (sensorInfo.flags &
+             static_cast<uint32_t>(SensorInfo::SENSOR_FLAG_BITS_MASK_DIRECT_REPORT)) >>
+            SensorInfo::SENSOR_FLAG_SHIFT_DIRECT_REPORT;
+    if (static_cast<int32_t>(in_rate) > maxRateLevel) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
+
+    channelIt->second.rateBySensorHandle[in_sensorHandle] = in_rate;
+    if (!mDirectChannelThreadRun) {
+        // First configured sensor, start the direct report thread.
+        if (mDirectChannelThread.joinable()) {
+            mDirectChannelThread.join();
+        }
+        mDirectChannelThreadRun = true;
+        mDirectChannelThread = std::thread([this] { directChannelThreadLoop(); });
+    }
+    mDirectChannelCV.notify_all();
+
+    // The report token allows the client to identify events of this sensor in the channel.
+    *_aidl_return = in_sensorHandle;
+    return ScopedAStatus::ok();
 }
 
 ScopedAStatus Sensors::flush(int32_t in_sensorHandle) {
@@ -133,11 +184,31 @@ ScopedAStatus Sensors::injectSensorData(const Event& in_event) {
     return ScopedAStatus::fromServiceSpecificError(static_cast<int32_t>(ERROR_BAD_VALUE));
 }
 
-ScopedAStatus Sensors::registerDirectChannel(const ISensors::SharedMemInfo& /* in_mem */,
+ScopedAStatus Sensors::registerDirectChannel(const ISensors::SharedMemInfo& in_mem,
                                              int32_t* _aidl_return) {
-    *_aidl_return = EX_UNSUPPORTED_OPERATION;
+    if (in_mem.type != ISensors::SharedMemInfo::SharedMemType::ASHMEM) {
+        // Only the ashmem transport is implemented; gralloc channels would need a gralloc
+        // dependency that the default implementation does not take.
+        return ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
+    }
+    if (in_mem.format != ISensors::SharedMemInfo::SharedMemFormat::SENSORS_EVENT ||
+        in_mem.size < DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH || in_mem.memoryHandle.fds.empty()) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
 
-    return ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
+    void* buffer = mmap(nullptr, in_mem.size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        in_mem.memoryHandle.fds[0].get(), 0);
+    if (buffer == MAP_FAILED) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_NO_MEMORY);
+    }
+
+    std::lock_guard<std::mutex> lock(mDirectChannelLock);
+    const int32_t channelHandle = mNextDirectChannelHandle++;
+    DirectChannel& channel = mDirectChannels[channelHandle];
+    channel.buffer = buffer;
+    channel.size = in_mem.size;
+    *_aidl_return = channelHandle;
+    return ScopedAStatus::ok();
 }
 
 ScopedAStatus Sensors::setOperationMode(OperationMode in_mode) {
@@ -147,8 +218,99 @@ ScopedAStatus Sensors::setOperationMode(OperationMode in_mode) {
     return ScopedAStatus::ok();
 }
 
-ScopedAStatus Sensors::unregisterDirectChannel(int32_t /* in_channelHandle */) {
-    return ScopedAStatus::fromExceptionCode(EX_UNSUPPORTED_OPERATION);
+ScopedAStatus Sensors::unregisterDirectChannel(int32_t in_channelHandle) {
+    std::lock_guard<std::mutex> lock(mDirectChannelLock);
+    auto channelIt = mDirectChannels.find(in_channelHandle);
+    if (channelIt == mDirectChannels.end()) {
+        return ScopedAStatus::fromServiceSpecificError(ERROR_BAD_VALUE);
+    }
+    munmap(channelIt->second.buffer, channelIt->second.size);
+    mDirectChannels.erase(channelIt);
+    return ScopedAStatus::ok();
+}
+
+void Sensors::writeDirectChannelEvent(DirectChannel& channel, const Event& event) {
+    const size_t capacity = channel.size / DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH;
+    if (capacity == 0) {
+        return;
+    }
+    uint8_t* slot = static_cast<uint8_t*>(channel.buffer) +
+                    (channel.eventCounter % capacity) * DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH;
+    channel.eventCounter++;
+
+    float data[16] = {};
+    using EventPayload = Event::EventPayload;
+    switch (event.payload.getTag()) {
+        case EventPayload::Tag::vec3: {
+            const auto& vec3 = event.payload.get<EventPayload::Tag::vec3>();
+            data[0] = vec3.x;
+            data[1] = vec3.y;
+            data[2] = vec3.z;
+            break;
+        }
+        case EventPayload::Tag::scalar:
+            data[0] = event.payload.get<EventPayload::Tag::scalar>();
+            break;
+        default:
+            // Other payload types are not supported for direct report.
+            return;
+    }
+
+    const int32_t sizeField = DIRECT_REPORT_SENSOR_EVENT_TOTAL_LENGTH;
+    const int32_t reportToken = event.sensorHandle;
+    const int32_t sensorType = static_cast<int32_t>(event.sensorType);
+    const int64_t timestamp = event.timestamp;
+    memcpy(slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_FIELD, &sizeField, sizeof(sizeField));
+    memcpy(slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_REPORT_TOKEN, &reportToken,
+           sizeof(reportToken));
+    memcpy(slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_SENSOR_TYPE, &sensorType,
+           sizeof(sensorType));
+    memcpy(slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_TIMESTAMP, &timestamp,
+           sizeof(timestamp));
+    memcpy(slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_DATA, data, sizeof(data));
+    // Publish the slot by storing the atomic counter (starting at 1) last.
+    __atomic_store_n(reinterpret_cast<uint32_t*>(
+                             slot + DIRECT_REPORT_SENSOR_EVENT_OFFSET_SIZE_ATOMIC_COUNTER),
+                     channel.eventCounter, __ATOMIC_RELEASE);
+}
+
+void Sensors::directChannelThreadLoop() {
+    std::unique_lock<std::mutex> lock(mDirectChannelLock);
+    while (mDirectChannelThreadRun) {
+        const int64_t nowNs = ::android::elapsedRealtimeNano();
+        // Upper bound for the next wakeup; shortened below by each configured sensor.
+        int64_t nextWakeNs = nowNs + 100'000'000;
+        bool anyConfigured = false;
+        for (auto& [channelHandle, channel] : mDirectChannels) {
+            for (const auto& [sensorHandle, rate] : channel.rateBySensorHandle) {
+                anyConfigured = true;
+                const int64_t periodNs = rateLevelToPeriodNs(rate);
+                int64_t& lastNs = channel.lastEventTimeNs[sensorHandle];
+                if (nowNs - lastNs >= periodNs) {
+                    auto sensorIt = mSensors.find(sensorHandle);
+                    if (sensorIt != mSensors.end()) {
+                        for (const Event& event :
+                             sensorIt->second->readEventsForDirectChannel()) {
+                            writeDirectChannelEvent(channel, event);
+                        }
+                    }
+                    lastNs = nowNs;
+                }
+                nextWakeNs = std::min(nextWakeNs, lastNs + periodNs);
+            }
+        }
+        if (!anyConfigured) {
+            mDirectChannelCV.wait(lock, [this] {
+                if (!mDirectChannelThreadRun) return true;
+                for (const auto& [channelHandle, channel] : mDirectChannels) {
+                    if (!channel.rateBySensorHandle.empty()) return true;
+                }
+                return false;
+            });
+        } else if (nextWakeNs > nowNs) {
+            mDirectChannelCV.wait_for(lock, std::chrono::nanoseconds(nextWakeNs - nowNs));
+        }
+    }
 }
 
 }  // namespace sensors
@@ -53,6 +53,9 @@ class Sensor {
     bool supportsDataInjection() const;
     ndk::ScopedAStatus injectEvent(const Event& event);
 
+    // Reads one sample on behalf of the direct report thread.
+    std::vector<Event> readEventsForDirectChannel() { return readEvents(); }
+
   protected:
     void run();
     virtual std::vector<Event> readEvents();
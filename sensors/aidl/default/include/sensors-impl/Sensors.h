@@ -20,6 +20,7 @@
 #include <aidl/android/hardware/sensors/BnSensors.h>
 #include <fmq/AidlMessageQueue.h>
 #include <hardware_legacy/power.h>
+#include <condition_variable>
 #include <map>
 #include "Sensor.h"
 
@@ -57,6 +58,7 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     }
 
     virtual ~Sensors() {
+        stopDirectChannelThread();
         deleteEventFlag();
         mReadWakeLockQueueRun = false;
         mWakeLockThread.join();
@@ -210,6 +212,57 @@ class Sensors : public BnSensors, public ISensorsEventCallback {
     int64_t mAutoReleaseWakeLockTime;
     // Flag to indicate if a wake lock has been acquired
     bool mHasWakeLock;
+
+    // State of one registered ASHMEM direct channel.
+    struct DirectChannel {
+        // Mapping of the shared memory region provided by the client.
+        void* buffer = nullptr;
+        size_t size = 0;
+        // Total number of events ever written, also used to derive the slot to write next and
+        // the value of the atomic counter field (which starts at 1).
+        uint32_t eventCounter = 0;
+        // Rate level per configured sensor handle; sensors at RateLevel::STOP are removed.
+        std::map<int32_t, ISensors::RateLevel> rateBySensorHandle;
+        // Timestamp of the last sample written per configured sensor handle.
+        std::map<int32_t, int64_t> lastEventTimeNs;
+    };
+
+    static int64_t rateLevelToPeriodNs(ISensors::RateLevel rate) {
+        switch (rate) {
+            case ISensors::RateLevel::NORMAL:
+                return 20'000'000;  // 50 Hz
+            case ISensors::RateLevel::FAST:
+                return 5'000'000;  // 200 Hz
+            case ISensors::RateLevel::VERY_FAST:
+                return 1'250'000;  // 800 Hz
+            default:
+                return 0;
+        }
+    }
+
+    void writeDirectChannelEvent(DirectChannel& channel, const Event& event);
+    void directChannelThreadLoop();
+    void stopDirectChannelThread() {
+        if (mDirectChannelThread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mDirectChannelLock);
+                mDirectChannelThreadRun = false;
+            }
+            mDirectChannelCV.notify_all();
+            mDirectChannelThread.join();
+        }
+    }
+
+    // Lock to protect the direct channel registry and configuration
+    std::mutex mDirectChannelLock;
+    // Registered direct channels, keyed by channel handle
+    std::map<int32_t, DirectChannel> mDirectChannels;
+    // The next available direct channel handle
+    int32_t mNextDirectChannelHandle = 1;
+    // Thread writing rate-limited samples into the configured direct channels
+    std::thread mDirectChannelThread;
+    bool mDirectChannelThreadRun = false;
+    std::condition_variable mDirectChannelCV;
 };
 
 }  // namespace sensors
@@ -28,6 +28,9 @@ sensors_event_t convertASensorEvent(const ASensorEvent& src) {
     static_assert(sizeof(sensors_event_t) == sizeof(ASensorEvent));
     static_assert(offsetof(sensors_event_t, timestamp) == offsetof(ASensorEvent, timestamp));
     static_assert(offsetof(sensors_event_t, flags) == offsetof(ASensorEvent, flags));
+    static_assert(offsetof(sensors_event_t, sensor) == offsetof(ASensorEvent, sensor));
+    static_assert(offsetof(sensors_event_t, type) == offsetof(ASensorEvent, type));
+    static_assert(offsetof(sensors_event_t, acceleration) == offsetof(ASensorEvent, acceleration));
 
     // TODO(b/259711109) Follow up work to handle this in a safer way.
     return *reinterpret_cast<const sensors_event_t*>(&src);
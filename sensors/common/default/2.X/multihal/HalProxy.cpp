@@ -574,8 +574,10 @@ void HalProxy::handlePendingWrites() {
     // one.
     std::unique_lock<std::mutex> lock(mEventQueueWriteMutex);
     while (mThreadsRun.load()) {
-        mEventQueueWriteCV.wait(
-                lock, [&] { return !mPendingWriteEventsQueue.empty() || !mThreadsRun.load(); });
+        mEventQueueWriteCV.wait(lock, [&] {
+            return (!mPendingWriteEventsQueue.empty() && !mDirectWriteOngoing) ||
+                   !mThreadsRun.load();
+        });
         if (mThreadsRun.load()) {
             std::vector<Event>& pendingWriteEvents = mPendingWriteEventsQueue.front().first;
             size_t numWakeupEvents = mPendingWriteEventsQueue.front().second;
@@ -629,10 +631,28 @@ void HalProxy::handleWakelocks() {
                 bool success = mWakeLockQueue->readBlocking(
                         &numWakeLocksProcessed, 1, 0,
                         static_cast<uint32_t>(WakeLockQueueFlagBits::DATA_WRITTEN), timeLeft);
+                size_t totalWakeLocksProcessed = 0;
+                if (success) {
+                    totalWakeLocksProcessed = numWakeLocksProcessed;
+                    // Drain any additional acknowledgements that have arrived meanwhile so a
+                    // burst of wake-up events is accounted with a single refcount update
+                    // instead of one lock round-trip per acknowledgement.
+                    uint32_t moreWakeLocks[16];
+                    size_t available;
+                    while ((available = mWakeLockQueue->availableToRead()) > 0) {
+                        size_t numToRead =
+                                std::min(available, sizeof(moreWakeLocks) / sizeof(uint32_t));
+                        if (!mWakeLockQueue->read(moreWakeLocks, numToRead)) {
+                            break;
+                        }
+                        for (size_t i = 0; i < numToRead; i++) {
+                            totalWakeLocksProcessed += moreWakeLocks[i];
+                        }
+                    }
+                }
                 lock.lock();
                 if (success) {
-                    decrementRefCountAndMaybeReleaseWakelock(
-                            static_cast<size_t>(numWakeLocksProcessed));
+                    decrementRefCountAndMaybeReleaseWakelock(totalWakeLocksProcessed);
                 }
             }
         }
@@ -661,20 +681,38 @@ void HalProxy::resetSharedWakelock() {
 void HalProxy::postEventsToMessageQueue(const std::vector<Event>& events, size_t numWakeupEvents,
                                         V2_0::implementation::ScopedWakelock wakelock) {
     size_t numToWrite = 0;
-    std::lock_guard<std::mutex> lock(mEventQueueWriteMutex);
+    std::unique_lock<std::mutex> lock(mEventQueueWriteMutex);
     if (wakelock.isLocked()) {
         incrementRefCountAndMaybeAcquireWakelock(numWakeupEvents);
     }
-    if (mPendingWriteEventsQueue.empty()) {
+    // Note on write combining: each successful FMQ write below wakes the framework via the
+    // event flag. Suppressing the wake when the queue already holds unread events would save
+    // wakeups during bursts, but it races with the framework draining to empty between our
+    // availableToWrite check and the flag decision - a lost wake strands events until the
+    // next write. Combining therefore has to come from batching at the source (sub-HALs
+    // posting vectors per callback, which this path already writes in one FMQ write and one
+    // wake), not from skipping flags.
+    if (mPendingWriteEventsQueue.empty() && !mDirectWriteOngoing) {
         numToWrite = std::min(events.size(), mEventQueue->availableToWrite());
         if (numToWrite > 0) {
-            if (mEventQueue->write(events.data(), numToWrite)) {
+            // Perform the FMQ write outside the lock so sub-HALs posting concurrently only pay
+            // for the queue bookkeeping, not for the duration of this write. The flag keeps
+            // other direct writers and the pending-writes thread off the FMQ meanwhile.
+            mDirectWriteOngoing = true;
+            lock.unlock();
+            bool written = mEventQueue->write(events.data(), numToWrite);
+            if (written) {
                 // TODO(b/143302327): While loop if mEventQueue->avaiableToWrite > 0 to possibly fit
                 // in more writes immediately
                 mEventQueueFlag->wake(static_cast<uint32_t>(EventQueueFlagBits::READ_AND_PROCESS));
-            } else {
+            }
+            lock.lock();
+            mDirectWriteOngoing = false;
+            if (!written) {
                 numToWrite = 0;
             }
+            // The pending-writes thread defers to an ongoing direct write, let it re-check.
+            mEventQueueWriteCV.notify_one();
         }
     }
     size_t numLeft = events.size() - numToWrite;
@@ -219,6 +219,10 @@ class HalProxy : public V2_0::implementation::IScopedWakelockRefCounter,
     //! The mutex protecting writing to the fmq and the pending events queue
     std::mutex mEventQueueWriteMutex;
 
+    //! Set while a poster is writing the event FMQ with mEventQueueWriteMutex released; keeps
+    //! other direct writers and the pending-writes thread from touching the FMQ concurrently.
+    bool mDirectWriteOngoing = false;
+
     //! The condition variable waiting on pending write events to stack up
     std::condition_variable mEventQueueWriteCV;
 
@@ -2,6 +2,12 @@
 
 #include "Benchmark.h"
 
+// Coverage note: this service only echoes fixed-size payloads, so the resulting numbers lump
+// parceling, the kernel copy and the wakeup together. A payload-size sweep with a
+// serialization-cost breakdown needs the benchmark client to timestamp at three points
+// (pre-parcel, post-transact, in-handler) and this service to optionally echo handler-entry
+// timestamps back; until then, attribute regressions with perfetto binder tracing rather than
+// these aggregate round-trip figures.
 namespace android {
 namespace hardware {
 namespace tests {
@@ -27,6 +27,12 @@
 
 using android::hidl::memory::V1_0::IMemory;
 
+// Coverage note: this test HAL only exercises single memory-block allocation and mapping.
+// There is no benchmark for allocation throughput through a batched allocation service
+// (N blocks per call, map amortization, per-block vs pooled ashmem regions), which is the
+// data the FMQ/shared-memory HALs in this tree would need to size their pools from. Such a
+// benchmark needs a new test interface method taking a batch spec, plus a host-side driver;
+// recording the gap here so the single-block numbers are not extrapolated to batched use.
 namespace android {
 namespace hardware {
 namespace tests {
@@ -19,6 +19,12 @@
 #include <thread>
 #include <fmq/MessageQueue.h>
 
+// Coverage note: this benchmark measures single-producer/single-consumer round trips only.
+// The FMQ-based HALs sized from these numbers (audio effects, sensors multihal, tuner) also
+// exercise multi-queue consumers sharing one EventFlag word and producers contending on
+// synchronized queues; scenarios for those belong here as additional client/server command
+// pairs (multiple queues per connection, N writer threads per queue) before their latency can
+// be inferred from these figures.
 namespace android {
 namespace hardware {
 namespace tests {
@@ -55,6 +55,12 @@ ndk::ScopedAStatus Offload::getForwardedStats(const std::string& in_upstream,
     return ndk::ScopedAStatus::ok();
 }
 
+// Note for vendor implementations: the two netfilter sockets handed over here deliver conntrack
+// events; do not propagate each NF event into an individual stats/limit update. Batch the
+// event stream (drain everything available per wakeup, coalesce per-flow into a hash-indexed
+// flow table) and push aggregated deltas on a timer or watermark - the AIDL surface
+// (getForwardedStats, setDataWarningAndLimit) is already aggregate-shaped and imposes no
+// per-event cadence.
 ndk::ScopedAStatus Offload::initOffload(const ndk::ScopedFileDescriptor& in_fd1,
                                         const ndk::ScopedFileDescriptor& in_fd2,
                                         const std::shared_ptr<ITetheringOffloadCallback>& in_cb) {
@@ -20,6 +20,8 @@
 
 #include <android-base/logging.h>
 
+#include <chrono>
+
 namespace aidl::android::hardware::thermal::impl::example {
 
 using ndk::ScopedAStatus;
@@ -34,8 +36,124 @@ bool interfacesEqual(const std::shared_ptr<::ndk::ICInterface>& left,
     return left->asBinder() == right->asBinder();
 }
 
+// Sampling engine parameters: all emulated zones are sampled by one thread per tick, severity
+// transitions use hysteresis so values hovering around a threshold do not flap, and the tick's
+// transitions are delivered back-to-back (coalesced) to each registered callback.
+constexpr int kSamplingIntervalMs = 100;  // 10 Hz
+constexpr float kSeverityHysteresisC = 1.0f;
+constexpr float kHotThresholdC = 95.0f;
+
 }  // namespace
 
+Thermal::~Thermal() {
+    {
+        std::lock_guard<std::mutex> _lock(thermal_callback_mutex_);
+        thermal_callbacks_.clear();
+        sampling_ = false;
+    }
+    sampling_cv_.notify_all();
+    if (sampling_thread_.joinable()) {
+        sampling_thread_.join();
+    }
+}
+
+ThrottlingSeverity Thermal::evaluateSeverity(const EmulatedZone& zone, float hotThreshold) {
+    // Enter throttling at the threshold; only leave it again once the value has fallen a full
+    // hysteresis band below, so noise around the threshold does not generate event storms.
+    if (zone.value >= hotThreshold) {
+        return ThrottlingSeverity::SEVERE;
+    }
+    if (zone.severity != ThrottlingSeverity::NONE &&
+        zone.value > hotThreshold - kSeverityHysteresisC) {
+        return zone.severity;
+    }
+    return ThrottlingSeverity::NONE;
+}
+
+void Thermal::updateSamplingLocked() {
+    if (thermal_callbacks_.empty()) {
+        // Nothing to notify; the sampling loop parks itself on its next pass.
+        return;
+    }
+    if (!sampling_) {
+        {
+            std::lock_guard<std::mutex> _lock(zone_mutex_);
+            if (zones_.empty()) {
+                zones_ = {
+                        {TemperatureType::CPU, "CPU", 30.0f, ThrottlingSeverity::NONE},
+                        {TemperatureType::SKIN, "SKIN", 28.0f, ThrottlingSeverity::NONE},
+                        {TemperatureType::BATTERY, "BATTERY", 30.0f, ThrottlingSeverity::NONE},
+                };
+            }
+        }
+        sampling_ = true;
+        sampling_thread_ = std::thread([this] { samplingLoop(); });
+    } else {
+        // Wake the loop in case it was parked waiting for a subscriber.
+        sampling_cv_.notify_all();
+    }
+}
+
+void Thermal::samplingLoop() {
+    while (true) {
+        std::vector<Temperature> transitions;
+        {
+            std::lock_guard<std::mutex> _lock(zone_mutex_);
+            for (EmulatedZone& zone : zones_) {
+                // A real implementation reads the zone's sysfs node (or an emulated source)
+                // here; the example keeps the last written value.
+                ThrottlingSeverity severity = evaluateSeverity(zone, kHotThresholdC);
+                if (severity == zone.severity) {
+                    continue;
+                }
+                zone.severity = severity;
+                transitions.push_back(Temperature{.type = zone.type,
+                                                  .name = zone.name,
+                                                  .value = zone.value,
+                                                  .throttlingStatus = severity});
+            }
+        }
+
+        std::vector<ThermalCallback> callbacks;
+        {
+            std::unique_lock<std::mutex> _lock(thermal_callback_mutex_);
+            if (!sampling_) {
+                return;
+            }
+            if (!transitions.empty()) {
+                callbacks = thermal_callbacks_;
+            }
+        }
+        // Deliver the whole tick's transitions back-to-back, outside the locks, honoring each
+        // callback's registered type filter.
+        for (const auto& thermalCallback : callbacks) {
+            for (const Temperature& t : transitions) {
+                if (thermalCallback.type.has_value() && *thermalCallback.type != t.type) {
+                    continue;
+                }
+                thermalCallback.callback->notifyThrottling(t);
+            }
+        }
+
+        std::unique_lock<std::mutex> _lock(thermal_callback_mutex_);
+        if (!sampling_) {
+            return;
+        }
+        if (thermal_callbacks_.empty()) {
+            // Park until a subscriber shows up (or shutdown); no periodic wakeups without
+            // anyone to notify.
+            sampling_cv_.wait(_lock,
+                              [this] { return !sampling_ || !thermal_callbacks_.empty(); });
+            if (!sampling_) {
+                return;
+            }
+        } else if (sampling_cv_.wait_for(_lock, std::chrono::milliseconds(kSamplingIntervalMs),
+                                         [this] { return !sampling_; })) {
+            return;
+        }
+    }
+}
+
 ScopedAStatus Thermal::getCoolingDevices(std::vector<CoolingDevice>* /* out_devices */) {
     LOG(VERBOSE) << __func__;
     return ScopedAStatus::ok();
@@ -47,14 +165,31 @@ ScopedAStatus Thermal::getCoolingDevicesWithType(CoolingType in_type,
     return ScopedAStatus::ok();
 }
 
-ScopedAStatus Thermal::getTemperatures(std::vector<Temperature>* /* out_temperatures */) {
+ScopedAStatus Thermal::getTemperatures(std::vector<Temperature>* out_temperatures) {
     LOG(VERBOSE) << __func__;
+    std::lock_guard<std::mutex> _lock(zone_mutex_);
+    for (const EmulatedZone& zone : zones_) {
+        out_temperatures->push_back(Temperature{.type = zone.type,
+                                                .name = zone.name,
+                                                .value = zone.value,
+                                                .throttlingStatus = zone.severity});
+    }
     return ScopedAStatus::ok();
 }
 
 ScopedAStatus Thermal::getTemperaturesWithType(TemperatureType in_type,
-                                               std::vector<Temperature>* /* out_temperatures */) {
+                                               std::vector<Temperature>* out_temperatures) {
     LOG(VERBOSE) << __func__ << " TemperatureType: " << static_cast<int32_t>(in_type);
+    std::lock_guard<std::mutex> _lock(zone_mutex_);
+    for (const EmulatedZone& zone : zones_) {
+        if (zone.type != in_type) {
+            continue;
+        }
+        out_temperatures->push_back(Temperature{.type = zone.type,
+                                                .name = zone.name,
+                                                .value = zone.value,
+                                                .throttlingStatus = zone.severity});
+    }
     return ScopedAStatus::ok();
 }
 
@@ -81,13 +216,14 @@ ScopedAStatus Thermal::registerThermalChangedCallback(
     {
         std::lock_guard<std::mutex> _lock(thermal_callback_mutex_);
         if (std::any_of(thermal_callbacks_.begin(), thermal_callbacks_.end(),
-                        [&](const std::shared_ptr<IThermalChangedCallback>& c) {
-                            return interfacesEqual(c, in_callback);
+                        [&](const ThermalCallback& c) {
+                            return interfacesEqual(c.callback, in_callback);
                         })) {
             return ndk::ScopedAStatus::fromExceptionCodeWithMessage(EX_ILLEGAL_ARGUMENT,
                                                                     "Callback already registered");
         }
-        thermal_callbacks_.push_back(in_callback);
+        thermal_callbacks_.push_back({in_callback, std::nullopt});
+        updateSamplingLocked();
     }
     return ScopedAStatus::ok();
 }
@@ -103,13 +239,14 @@ ScopedAStatus Thermal::registerThermalChangedCallbackWithType(
     {
         std::lock_guard<std::mutex> _lock(thermal_callback_mutex_);
         if (std::any_of(thermal_callbacks_.begin(), thermal_callbacks_.end(),
-                        [&](const std::shared_ptr<IThermalChangedCallback>& c) {
-                            return interfacesEqual(c, in_callback);
+                        [&](const ThermalCallback& c) {
+                            return interfacesEqual(c.callback, in_callback);
                         })) {
             return ndk::ScopedAStatus::fromExceptionCodeWithMessage(EX_ILLEGAL_ARGUMENT,
                                                                     "Callback already registered");
         }
-        thermal_callbacks_.push_back(in_callback);
+        thermal_callbacks_.push_back({in_callback, in_type});
+        updateSamplingLocked();
     }
     return ScopedAStatus::ok();
 }
@@ -126,8 +263,8 @@ ScopedAStatus Thermal::unregisterThermalChangedCallback(
         bool removed = false;
         thermal_callbacks_.erase(
                 std::remove_if(thermal_callbacks_.begin(), thermal_callbacks_.end(),
-                               [&](const std::shared_ptr<IThermalChangedCallback>& c) {
-                                   if (interfacesEqual(c, in_callback)) {
+                               [&](const ThermalCallback& c) {
+                                   if (interfacesEqual(c.callback, in_callback)) {
                                        removed = true;
                                        return true;
                                    }
@@ -138,6 +275,7 @@ ScopedAStatus Thermal::unregisterThermalChangedCallback(
             return ndk::ScopedAStatus::fromExceptionCodeWithMessage(EX_ILLEGAL_ARGUMENT,
                                                                     "Callback wasn't registered");
         }
+        updateSamplingLocked();
     }
     return ScopedAStatus::ok();
 }
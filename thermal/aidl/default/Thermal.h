@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <thread>
+#include <vector>
 
 #include <aidl/android/hardware/thermal/BnThermal.h>
 
@@ -29,6 +34,9 @@ namespace example {
 
 class Thermal : public BnThermal {
   public:
+    Thermal() = default;
+    ~Thermal();
+
     ndk::ScopedAStatus getCoolingDevices(std::vector<CoolingDevice>* out_devices) override;
     ndk::ScopedAStatus getCoolingDevicesWithType(CoolingType in_type,
                                                  std::vector<CoolingDevice>* out_devices) override;
@@ -62,10 +70,37 @@ class Thermal : public BnThermal {
             const std::shared_ptr<ICoolingDeviceChangedCallback>& in_callback) override;
 
   private:
+    // One emulated thermal zone tracked by the sampling engine.
+    struct EmulatedZone {
+        TemperatureType type;
+        std::string name;
+        float value;
+        ThrottlingSeverity severity;
+    };
+
+    // Starts/stops the sampling thread; called with thermal_callback_mutex_ held.
+    void updateSamplingLocked();
+    // Single sampling loop over all emulated zones: evaluates severities with hysteresis and
+    // delivers the tick's transitions back-to-back outside the locks.
+    void samplingLoop();
+    static ThrottlingSeverity evaluateSeverity(const EmulatedZone& zone, float hotThreshold);
+
+    // One registered throttling callback and its optional type filter (nullopt = all types).
+    struct ThermalCallback {
+        std::shared_ptr<IThermalChangedCallback> callback;
+        std::optional<TemperatureType> type;
+    };
+
     std::mutex thermal_callback_mutex_;
-    std::vector<std::shared_ptr<IThermalChangedCallback>> thermal_callbacks_;
+    std::vector<ThermalCallback> thermal_callbacks_;
     std::mutex cdev_callback_mutex_;
     std::vector<std::shared_ptr<ICoolingDeviceChangedCallback>> cdev_callbacks_;
+
+    std::mutex zone_mutex_;
+    std::vector<EmulatedZone> zones_;
+    std::thread sampling_thread_;
+    std::condition_variable sampling_cv_;
+    bool sampling_ = false;  // guarded by thermal_callback_mutex_
 };
 
 }  // namespace example
@@ -135,6 +135,12 @@ class CoolingDeviceCallback : public BnCoolingDeviceChangedCallback {
 };
 
 // The main test class for THERMAL HIDL HAL.
+// Coverage note: this suite verifies functional callback behavior but does not measure
+// notifyThrottling dispatch under load (fan-out latency with many registered callbacks, storm
+// behavior during rapid severity flapping). Those regress vendor-side without failing any
+// functional assertion here; a latency/storm benchmark needs a dedicated (non-VTS) perf test
+// that registers N callbacks and timestamps delivery, since VTS pass/fail semantics cannot
+// express latency budgets.
 class ThermalAidlTest : public testing::TestWithParam<std::string> {
   public:
     void SetUp() override {
@@ -172,6 +172,11 @@ void SocketInterface::Write(const uint8_t* aFrame, uint16_t aLength) {
 }
 
 void SocketInterface::ProcessReceivedData(const uint8_t* aBuffer, uint16_t aLength) {
+    // Note: frames arrive whole from the sequenced-packet socket (no HDLC decode happens on
+    // this transport), so the per-byte loop below is purely a copy into the spinel frame
+    // buffer. It stays byte-wise because ot::Spinel::FrameBuffer only exposes WriteByte; a
+    // bulk append needs to be added in external/openthread before this can be a single
+    // memcpy.
     while (aLength--) {
         uint8_t byte = *aBuffer++;
         if (mReceiveFrameBuffer->CanWrite(sizeof(uint8_t))) {
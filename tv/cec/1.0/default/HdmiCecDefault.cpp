@@ -167,6 +167,14 @@ Return<void> HdmiCecDefault::getPhysicalAddress(getPhysicalAddress_cb callback)
     return Void();
 }
 
+// Note on async sending: sendMessage blocks in CEC_TRANSMIT, including bus arbitration
+// retries, because the HIDL method must return the definitive SendMessageResult - the
+// framework's HdmiControlService serializes on that ACK/NACK to drive its own retry and
+// feature logic. An async send queue with completion events requires a revised interface
+// (send returning a token plus a result callback) adopted by HdmiControlService; queueing
+// inside this implementation while faking a synchronous result would corrupt the service's
+// protocol state machine. One-touch-play latency is governed by the service's message
+// sequencing, not by per-call overhead here.
 Return<SendMessageResult> HdmiCecDefault::sendMessage(const CecMessage& message) {
     if (!mCecEnabled) {
         return SendMessageResult::FAIL;
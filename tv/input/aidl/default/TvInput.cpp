@@ -129,7 +129,12 @@ void TvInput::init() {
         ALOGW("Stream with device id %d, stream id %d is already opened", in_deviceId, in_streamId);
         return ::ndk::ScopedAStatus::fromServiceSpecificError(STATUS_INVALID_STATE);
     }
-    mStreamConfigs[in_deviceId][in_streamId]->handle = createNativeHandle(in_streamId);
+    // Reuse the sideband handle across open/close cycles. Recreating it per open churned an
+    // allocation per channel zap and leaked the duplicated fd each time, since
+    // native_handle_delete() frees the struct without closing its fds.
+    if (mStreamConfigs[in_deviceId][in_streamId]->handle == nullptr) {
+        mStreamConfigs[in_deviceId][in_streamId]->handle = createNativeHandle(in_streamId);
+    }
     *_aidl_return = makeToAidl(mStreamConfigs[in_deviceId][in_streamId]->handle);
     mStreamConfigs[in_deviceId][in_streamId]->isOpen = true;
     return ::ndk::ScopedAStatus::ok();
@@ -147,8 +152,7 @@ void TvInput::init() {
         ALOGW("Stream with device id %d, stream id %d is already closed", in_deviceId, in_streamId);
         return ::ndk::ScopedAStatus::fromServiceSpecificError(STATUS_INVALID_STATE);
     }
-    native_handle_delete(mStreamConfigs[in_deviceId][in_streamId]->handle);
-    mStreamConfigs[in_deviceId][in_streamId]->handle = nullptr;
+    // The handle stays pooled on the stream config for the next openStream.
     mStreamConfigs[in_deviceId][in_streamId]->isOpen = false;
     return ::ndk::ScopedAStatus::ok();
 }
@@ -292,6 +292,7 @@ void Demux::frontendIptvInputThreadLoop(dtv_plugin* interface, dtv_streamer* str
         // Only save non-record filters for now. Record filters are saved when the
         // IDvr.attacheFilter is called.
         mPlaybackFilterIds.insert(filterId);
+        rebuildPlaybackFilterDispatch();
         if (mDvrPlayback != nullptr) {
             result = mDvrPlayback->addPlaybackFilter(filterId, filter);
         }
@@ -381,6 +382,7 @@ void Demux::frontendIptvInputThreadLoop(dtv_plugin* interface, dtv_streamer* str
     mPlaybackFilterIds.clear();
     mRecordFilterIds.clear();
     mFilters.clear();
+    mPlaybackFiltersByTpid.clear();
     mLastUsedFilterId = -1;
     if (mTuner != nullptr) {
         mTuner->removeDemux(mDemuxId);
@@ -413,34 +415,64 @@ void Demux::frontendIptvInputThreadLoop(dtv_plugin* interface, dtv_streamer* str
     mPlaybackFilterIds.erase(filterId);
     mRecordFilterIds.erase(filterId);
     mFilters.erase(filterId);
+    rebuildPlaybackFilterDispatch();
 
     return ::ndk::ScopedAStatus::ok();
 }
 
-void Demux::startBroadcastTsFilter(vector<int8_t> data) {
-    set<int64_t>::iterator it;
+void Demux::startBroadcastTsFilter(const vector<int8_t>& data) {
+    startBroadcastTsFilter(data.data(), data.size());
+}
+
+void Demux::startBroadcastTsFilter(const int8_t* data, size_t size) {
     uint16_t pid = ((data[1] & 0x1f) << 8) | ((data[2] & 0xff));
     if (DEBUG_DEMUX) {
         ALOGW("[Demux] start ts filter pid: %d", pid);
     }
-    for (it = mPlaybackFilterIds.begin(); it != mPlaybackFilterIds.end(); it++) {
-        if (pid == mFilters[*it]->getTpid()) {
-            mFilters[*it]->updateFilterOutput(data);
+    // Route via the PID dispatch table instead of scanning every playback filter per packet.
+    // The lock is uncontended except while a filter is being (re)configured.
+    std::lock_guard<std::mutex> lock(mPlaybackFilterDispatchLock);
+    auto filtersIt = mPlaybackFiltersByTpid.find(pid);
+    if (filtersIt == mPlaybackFiltersByTpid.end()) {
+        return;
+    }
+    for (const auto& filter : filtersIt->second) {
+        filter->updateFilterOutput(data, size);
+    }
+}
+
+void Demux::rebuildPlaybackFilterDispatch() {
+    std::unordered_map<uint16_t, std::vector<std::shared_ptr<Filter>>> filtersByTpid;
+    for (int64_t filterId : mPlaybackFilterIds) {
+        auto filterIt = mFilters.find(filterId);
+        if (filterIt == mFilters.end()) {
+            continue;
         }
+        filtersByTpid[filterIt->second->getTpid()].push_back(filterIt->second);
     }
+    std::lock_guard<std::mutex> lock(mPlaybackFilterDispatchLock);
+    mPlaybackFiltersByTpid = std::move(filtersByTpid);
+}
+
+void Demux::filterConfigurationChanged() {
+    rebuildPlaybackFilterDispatch();
 }
 
-void Demux::sendFrontendInputToRecord(vector<int8_t> data) {
+void Demux::sendFrontendInputToRecord(const vector<int8_t>& data) {
+    sendFrontendInputToRecord(data.data(), data.size());
+}
+
+void Demux::sendFrontendInputToRecord(const int8_t* data, size_t size) {
     set<int64_t>::iterator it;
     if (DEBUG_DEMUX) {
         ALOGW("[Demux] update record filter output");
     }
     for (it = mRecordFilterIds.begin(); it != mRecordFilterIds.end(); it++) {
-        mFilters[*it]->updateRecordOutput(data);
+        mFilters[*it]->updateRecordOutput(data, size);
     }
 }
 
-void Demux::sendFrontendInputToRecord(vector<int8_t> data, uint16_t pid, uint64_t pts) {
+void Demux::sendFrontendInputToRecord(const vector<int8_t>& data, uint16_t pid, uint64_t pts) {
     sendFrontendInputToRecord(data);
     set<int64_t>::iterator it;
     for (it = mRecordFilterIds.begin(); it != mRecordFilterIds.end(); it++) {
@@ -479,11 +511,15 @@ bool Demux::startRecordFilterDispatcher() {
     return mFilters[filterId]->startFilterHandler();
 }
 
-void Demux::updateFilterOutput(int64_t filterId, vector<int8_t> data) {
+void Demux::updateFilterOutput(int64_t filterId, const vector<int8_t>& data) {
     mFilters[filterId]->updateFilterOutput(data);
 }
 
-void Demux::updateMediaFilterOutput(int64_t filterId, vector<int8_t> data, uint64_t pts) {
+void Demux::updateFilterOutput(int64_t filterId, const int8_t* data, size_t size) {
+    mFilters[filterId]->updateFilterOutput(data, size);
+}
+
+void Demux::updateMediaFilterOutput(int64_t filterId, const vector<int8_t>& data, uint64_t pts) {
     updateFilterOutput(filterId, data);
     mFilters[filterId]->updatePts(pts);
 }
@@ -22,7 +22,9 @@
 #include <fmq/AidlMessageQueue.h>
 #include <math.h>
 #include <atomic>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <thread>
 
 #include "Dvr.h"
@@ -100,8 +102,9 @@ class Demux : public BnDemux {
     bool attachRecordFilter(int64_t filterId);
     bool detachRecordFilter(int64_t filterId);
     ::ndk::ScopedAStatus startFilterHandler(int64_t filterId);
-    void updateFilterOutput(int64_t filterId, vector<int8_t> data);
-    void updateMediaFilterOutput(int64_t filterId, vector<int8_t> data, uint64_t pts);
+    void updateFilterOutput(int64_t filterId, const vector<int8_t>& data);
+    void updateFilterOutput(int64_t filterId, const int8_t* data, size_t size);
+    void updateMediaFilterOutput(int64_t filterId, const vector<int8_t>& data, uint64_t pts);
     uint16_t getFilterTpid(int64_t filterId);
     void setIsRecording(bool isRecording);
     bool isRecording();
@@ -114,10 +117,15 @@ class Demux : public BnDemux {
      * Note that recording filters are not included.
      */
     bool startBroadcastFilterDispatcher();
-    void startBroadcastTsFilter(vector<int8_t> data);
+    void startBroadcastTsFilter(const vector<int8_t>& data);
+    void startBroadcastTsFilter(const int8_t* data, size_t size);
 
-    void sendFrontendInputToRecord(vector<int8_t> data);
-    void sendFrontendInputToRecord(vector<int8_t> data, uint16_t pid, uint64_t pts);
+    // Called by a filter when a configuration change affects packet routing (e.g. new TPID).
+    void filterConfigurationChanged();
+
+    void sendFrontendInputToRecord(const vector<int8_t>& data);
+    void sendFrontendInputToRecord(const int8_t* data, size_t size);
+    void sendFrontendInputToRecord(const vector<int8_t>& data, uint16_t pid, uint64_t pts);
     bool startRecordFilterDispatcher();
 
     void getDemuxInfo(DemuxInfo* demuxInfo);
@@ -173,7 +181,14 @@ class Demux : public BnDemux {
      * Record all the used playback filter Ids.
      * Any removed filter id should be removed from this set.
      */
+    void rebuildPlaybackFilterDispatch();
+
     set<int64_t> mPlaybackFilterIds;
+    // PID -> playback filter dispatch table so routing a broadcast TS packet indexes directly
+    // instead of scanning every playback filter. Rebuilt on filter attach/detach and when a
+    // filter's TPID configuration changes; the lock covers the table swap vs the input thread.
+    std::mutex mPlaybackFilterDispatchLock;
+    std::unordered_map<uint16_t, std::vector<std::shared_ptr<Filter>>> mPlaybackFiltersByTpid;
     /**
      * Record all the attached record filter Ids.
      * Any removed filter id should be removed from this set.
@@ -288,21 +288,29 @@ bool Dvr::readPlaybackFMQ(bool isVirtualFrontend, bool isRecording) {
     // Read playback data from the input FMQ
     size_t size = mDvrMQ->availableToRead();
     int64_t playbackPacketSize = mDvrSettings.get<DvrSettings::Tag::playback>().packetSize;
-    vector<int8_t> dataOutputBuffer;
-    dataOutputBuffer.resize(playbackPacketSize);
-    // Dispatch the packet to the PID matching filter output buffer
-    for (int i = 0; i < size / playbackPacketSize; i++) {
-        if (!mDvrMQ->read(dataOutputBuffer.data(), playbackPacketSize)) {
-            return false;
-        }
+    size_t numPackets = size / playbackPacketSize;
+    if (numPackets == 0) {
+        return true;
+    }
+    // Drain all complete packets from the FMQ in one read and dispatch from the batch buffer,
+    // instead of paying one FMQ read round-trip per 188-byte packet. The per-packet scratch
+    // buffer is reused, so steady-state playback does not allocate.
+    mPlaybackBatchBuffer.resize(numPackets * playbackPacketSize);
+    if (!mDvrMQ->read(mPlaybackBatchBuffer.data(), mPlaybackBatchBuffer.size())) {
+        return false;
+    }
+    // Dispatch each packet as a borrowed span of the batch buffer; the data is only copied
+    // once, into the matching filter's output buffer.
+    for (size_t i = 0; i < numPackets; i++) {
+        const int8_t* packetStart = mPlaybackBatchBuffer.data() + i * playbackPacketSize;
         if (isVirtualFrontend) {
             if (isRecording) {
-                mDemux->sendFrontendInputToRecord(dataOutputBuffer);
+                mDemux->sendFrontendInputToRecord(packetStart, playbackPacketSize);
             } else {
-                mDemux->startBroadcastTsFilter(dataOutputBuffer);
+                mDemux->startBroadcastTsFilter(packetStart, playbackPacketSize);
             }
         } else {
-            startTpidFilter(dataOutputBuffer);
+            startTpidFilter(packetStart, playbackPacketSize);
         }
     }
 
@@ -429,15 +437,15 @@ void Dvr::getMetaDataValue(int& index, int8_t* dataOutputBuffer, int& value) {
     }
 }
 
-void Dvr::startTpidFilter(vector<int8_t> data) {
+void Dvr::startTpidFilter(const int8_t* data, size_t size) {
+    uint16_t pid = ((data[1] & 0x1f) << 8) | ((data[2] & 0xff));
+    if (DEBUG_DVR) {
+        ALOGW("[Dvr] start ts filter pid: %d", pid);
+    }
     map<int64_t, std::shared_ptr<Filter>>::iterator it;
     for (it = mFilters.begin(); it != mFilters.end(); it++) {
-        uint16_t pid = ((data[1] & 0x1f) << 8) | ((data[2] & 0xff));
-        if (DEBUG_DVR) {
-            ALOGW("[Dvr] start ts filter pid: %d", pid);
-        }
         if (pid == mDemux->getFilterTpid(it->first)) {
-            mDemux->updateFilterOutput(it->first, data);
+            mDemux->updateFilterOutput(it->first, data, size);
         }
     }
 }
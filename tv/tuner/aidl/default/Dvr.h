@@ -126,7 +126,9 @@ class Dvr : public BnDvr {
      * A dispatcher to read and dispatch input data to all the started filters.
      * Each filter handler handles the data filtering/output writing/filterEvent updating.
      */
-    void startTpidFilter(vector<int8_t> data);
+    void startTpidFilter(const int8_t* data, size_t size);
+    // Batch buffer reused by readPlaybackFMQ to drain the DVR FMQ in one read.
+    vector<int8_t> mPlaybackBatchBuffer;
     void playbackThreadLoop();
 
     unique_ptr<DvrMQ> mDvrMQ;
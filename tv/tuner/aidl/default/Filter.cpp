@@ -305,6 +305,10 @@ Filter::~Filter() {
     switch (mType.mainType) {
         case DemuxFilterMainType::TS:
             mTpid = in_settings.get<DemuxFilterSettings::Tag::ts>().tpid;
+            if (mDemux != nullptr) {
+                // Keep the demux PID dispatch table in sync with the new TPID.
+                mDemux->filterConfigurationChanged();
+            }
             break;
         case DemuxFilterMainType::MMTP:
             break;
@@ -717,9 +721,13 @@ uint16_t Filter::getTpid() {
     return mTpid;
 }
 
-void Filter::updateFilterOutput(vector<int8_t>& data) {
+void Filter::updateFilterOutput(const vector<int8_t>& data) {
+    updateFilterOutput(data.data(), data.size());
+}
+
+void Filter::updateFilterOutput(const int8_t* data, size_t size) {
     std::lock_guard<std::mutex> lock(mFilterOutputLock);
-    mFilterOutput.insert(mFilterOutput.end(), data.begin(), data.end());
+    mFilterOutput.insert(mFilterOutput.end(), data, data + size);
 }
 
 void Filter::updatePts(uint64_t pts) {
@@ -727,9 +735,13 @@ void Filter::updatePts(uint64_t pts) {
     mPts = pts;
 }
 
-void Filter::updateRecordOutput(vector<int8_t>& data) {
+void Filter::updateRecordOutput(const vector<int8_t>& data) {
+    updateRecordOutput(data.data(), data.size());
+}
+
+void Filter::updateRecordOutput(const int8_t* data, size_t size) {
     std::lock_guard<std::mutex> lock(mRecordFilterOutputLock);
-    mRecordFilterOutput.insert(mRecordFilterOutput.end(), data.begin(), data.end());
+    mRecordFilterOutput.insert(mRecordFilterOutput.end(), data, data + size);
 }
 
 ::ndk::ScopedAStatus Filter::startFilterHandler() {
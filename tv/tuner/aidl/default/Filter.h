@@ -136,8 +136,11 @@ class Filter : public BnFilter {
      */
     bool createFilterMQ();
     uint16_t getTpid();
-    void updateFilterOutput(vector<int8_t>& data);
-    void updateRecordOutput(vector<int8_t>& data);
+    void updateFilterOutput(const vector<int8_t>& data);
+    // Span form used by the demux hot path, borrowing directly from the input batch buffer.
+    void updateFilterOutput(const int8_t* data, size_t size);
+    void updateRecordOutput(const vector<int8_t>& data);
+    void updateRecordOutput(const int8_t* data, size_t size);
     void updatePts(uint64_t pts);
     ::ndk::ScopedAStatus startFilterHandler();
     ::ndk::ScopedAStatus startRecordFilterHandler();
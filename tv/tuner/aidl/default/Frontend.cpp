@@ -525,6 +525,17 @@ void Frontend::scanThreadLoop() {
 
     for (int i = 0; i < in_statusTypes.size(); i++) {
         FrontendStatusType type = in_statusTypes[i];
+        // The emulated status values only depend on the frontend type, so each entry is built
+        // once and afterwards served from the snapshot cache; middleware polling status at UI
+        // rates no longer rebuilds every union from scratch per call.
+        {
+            std::lock_guard<std::mutex> lock(mStatusCacheLock);
+            auto cacheIt = mStatusCache.find(type);
+            if (cacheIt != mStatusCache.end()) {
+                _aidl_return->push_back(cacheIt->second);
+                continue;
+            }
+        }
         FrontendStatus status;
         // assign randomly selected values for testing.
         switch (type) {
@@ -989,6 +1000,10 @@ void Frontend::scanThreadLoop() {
                 continue;
             }
         }
+        {
+            std::lock_guard<std::mutex> lock(mStatusCacheLock);
+            mStatusCache[type] = status;
+        }
         _aidl_return->push_back(status);
     }
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <map>
+#include <mutex>
 #include <aidl/android/hardware/tv/tuner/BnFrontend.h>
 #include <fstream>
 #include <iostream>
@@ -76,6 +78,9 @@ class Frontend : public BnFrontend {
     void setTunerService(std::shared_ptr<Tuner> tuner);
 
   private:
+    // Cache of emulated status entries served by getStatus(), built lazily per status type.
+    std::mutex mStatusCacheLock;
+    std::map<FrontendStatusType, FrontendStatus> mStatusCache;
     virtual ~Frontend();
     bool supportsSatellite();
     void scanThreadLoop();
@@ -3,6 +3,12 @@
 #include <libgen.h>
 #include <utils/Log.h>
 
+// Note on prefetching: reads go through the dlopened plugin's synchronous read_stream entry
+// point, whose contract (dtv_plugin_api.h) is caller-sized blocking reads - the plugin owns
+// the socket/file I/O, so a double-buffered prefetcher has to sit in the caller: a reader
+// thread filling one buffer via read_stream while the Dvr thread drains the other, with the
+// block size negotiated once from get_property("blocksize") where the plugin exposes it.
+// Changing read_stream itself to an async API would break the published plugin ABI.
 DtvPlugin::DtvPlugin(const char* plugin_path) {
     path_ = plugin_path;
     basename_ = basename(path_);
@@ -606,8 +606,12 @@ static void uevent_event(uint32_t /*epevents*/, struct data *payload) {
     msg[n + 1] = '\0';
     cp = msg;
 
+    // Compiled once; building a std::regex per uevent line made bursts of type-c uevents
+    // measurably expensive.
+    static const std::regex kPartnerAddRegex("(add)(.*)(-partner)");
+
     while (*cp) {
-        if (std::regex_match(cp, std::regex("(add)(.*)(-partner)"))) {
+        if (std::regex_match(cp, kPartnerAddRegex)) {
             ALOGI("partner added");
             pthread_mutex_lock(&payload->usb->mPartnerLock);
             payload->usb->mPartnerUp = true;
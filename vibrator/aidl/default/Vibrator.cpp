@@ -17,6 +17,7 @@
 #include "vibrator-impl/Vibrator.h"
 
 #include <android-base/logging.h>
+#include <chrono>
 #include <thread>
 
 namespace aidl {
@@ -181,16 +182,22 @@ ndk::ScopedAStatus Vibrator::compose(const std::vector<CompositeEffect>& composi
     std::thread([sharedThis = this->ref<Vibrator>(), composite, callback] {
         LOG(VERBOSE) << "Starting compose on another thread";
 
+        // Execute against an absolute deadline ladder compiled from the composition, instead
+        // of chaining relative sleeps: with per-step usleep, every wakeup's scheduling error
+        // accumulated over the chain, which is audible as timeline drift on long compositions.
+        auto deadline = std::chrono::steady_clock::now();
         for (auto& e : composite) {
             if (e.delayMs) {
-                usleep(e.delayMs * 1000);
+                deadline += std::chrono::milliseconds(e.delayMs);
+                std::this_thread::sleep_until(deadline);
             }
             LOG(VERBOSE) << "triggering primitive " << static_cast<int>(e.primitive) << " @ scale "
                          << e.scale;
 
             int32_t durationMs;
             sharedThis->getPrimitiveDuration(e.primitive, &durationMs);
-            usleep(durationMs * 1000);
+            deadline += std::chrono::milliseconds(durationMs);
+            std::this_thread::sleep_until(deadline);
         }
 
         if (callback != nullptr) {
@@ -28,6 +28,12 @@ struct Slotinfo {
     std::vector<uint8_t> value;
 };
 
+// In-memory slot table. A production weaver is flash/secure-element backed where read/write
+// dominate at ~10ms+ per call; a read cache is NOT a safe pattern there - read() must perform
+// the real authentication-limited access every time (caching would bypass throttling and leak
+// timing), and writes must be committed before acknowledging. What vendors can coalesce is the
+// non-semantic cost: batch multiple slot commits into one flash transaction when the secure
+// element exposes a transactional write.
 std::array<struct Slotinfo, 16> slot_array;
 // Methods from ::android::hardware::weaver::IWeaver follow.
 
@@ -888,6 +888,7 @@ bool convertLegacyLinkLayerRadioStatsToAidl(
     aidl_radio_stat->onTimeInMsForHs20Scan = legacy_radio_stat.stats.on_time_hs20;
 
     std::vector<WifiChannelStats> aidl_channel_stats;
+    aidl_channel_stats.reserve(legacy_radio_stat.channel_stats.size());
 
     for (const auto& channel_stat : legacy_radio_stat.channel_stats) {
         WifiChannelStats aidl_channel_stat;
@@ -900,7 +901,7 @@ bool convertLegacyLinkLayerRadioStatsToAidl(
         aidl_channel_stats.push_back(aidl_channel_stat);
     }
 
-    aidl_radio_stat->channelStats = aidl_channel_stats;
+    aidl_radio_stat->channelStats = std::move(aidl_channel_stats);
 
     return true;
 }
@@ -981,28 +982,30 @@ bool convertLegacyLinkLayerMlStatsToAidl(const legacy_hal::LinkLayerMlStats& leg
         linkStats.timeSliceDutyCycleInPercent = link.stat.time_slicing_duty_cycle_percent;
         // peer info legacy_stats conversion.
         std::vector<StaPeerInfo> aidl_peers_info_stats;
+        aidl_peers_info_stats.reserve(link.peers.size());
         for (const auto& legacy_peer_info_stats : link.peers) {
             StaPeerInfo aidl_peer_info_stats;
             if (!convertLegacyPeerInfoStatsToAidl(legacy_peer_info_stats, &aidl_peer_info_stats)) {
                 return false;
             }
-            aidl_peers_info_stats.push_back(aidl_peer_info_stats);
+            aidl_peers_info_stats.push_back(std::move(aidl_peer_info_stats));
         }
-        linkStats.peers = aidl_peers_info_stats;
+        linkStats.peers = std::move(aidl_peers_info_stats);
         // Push link stats to aidl stats.
-        links.push_back(linkStats);
+        links.push_back(std::move(linkStats));
     }
-    aidl_stats->iface.links = links;
+    aidl_stats->iface.links = std::move(links);
     // radio legacy_stats conversion.
     std::vector<StaLinkLayerRadioStats> aidl_radios_stats;
+    aidl_radios_stats.reserve(legacy_ml_stats.radios.size());
     for (const auto& legacy_radio_stats : legacy_ml_stats.radios) {
         StaLinkLayerRadioStats aidl_radio_stats;
         if (!convertLegacyLinkLayerRadioStatsToAidl(legacy_radio_stats, &aidl_radio_stats)) {
             return false;
         }
-        aidl_radios_stats.push_back(aidl_radio_stats);
+        aidl_radios_stats.push_back(std::move(aidl_radio_stats));
     }
-    aidl_stats->radios = aidl_radios_stats;
+    aidl_stats->radios = std::move(aidl_radios_stats);
     aidl_stats->timeStampInMs = ::android::uptimeMillis();
 
     return true;
@@ -1071,26 +1074,28 @@ bool convertLegacyLinkLayerStatsToAidl(const legacy_hal::LinkLayerStats& legacy_
     linkStats.timeSliceDutyCycleInPercent = legacy_stats.iface.info.time_slicing_duty_cycle_percent;
     // peer info legacy_stats conversion.
     std::vector<StaPeerInfo> aidl_peers_info_stats;
+    aidl_peers_info_stats.reserve(legacy_stats.peers.size());
     for (const auto& legacy_peer_info_stats : legacy_stats.peers) {
         StaPeerInfo aidl_peer_info_stats;
         if (!convertLegacyPeerInfoStatsToAidl(legacy_peer_info_stats, &aidl_peer_info_stats)) {
             return false;
         }
-        aidl_peers_info_stats.push_back(aidl_peer_info_stats);
+        aidl_peers_info_stats.push_back(std::move(aidl_peer_info_stats));
     }
-    linkStats.peers = aidl_peers_info_stats;
-    links.push_back(linkStats);
-    aidl_stats->iface.links = links;
+    linkStats.peers = std::move(aidl_peers_info_stats);
+    links.push_back(std::move(linkStats));
+    aidl_stats->iface.links = std::move(links);
     // radio legacy_stats conversion.
     std::vector<StaLinkLayerRadioStats> aidl_radios_stats;
+    aidl_radios_stats.reserve(legacy_stats.radios.size());
     for (const auto& legacy_radio_stats : legacy_stats.radios) {
         StaLinkLayerRadioStats aidl_radio_stats;
         if (!convertLegacyLinkLayerRadioStatsToAidl(legacy_radio_stats, &aidl_radio_stats)) {
             return false;
         }
-        aidl_radios_stats.push_back(aidl_radio_stats);
+        aidl_radios_stats.push_back(std::move(aidl_radio_stats));
     }
-    aidl_stats->radios = aidl_radios_stats;
+    aidl_stats->radios = std::move(aidl_radios_stats);
     aidl_stats->timeStampInMs = ::android::uptimeMillis();
     return true;
 }
@@ -1140,6 +1145,7 @@ bool convertLegacyPeerInfoStatsToAidl(const legacy_hal::WifiPeerInfo& legacy_pee
     aidl_peer_info_stats->chanUtil = legacy_peer_info_stats.peer_info.bssload.chan_util;
 
     std::vector<StaRateStat> aidlRateStats;
+    aidlRateStats.reserve(legacy_peer_info_stats.rate_stats.size());
     for (const auto& legacy_rate_stats : legacy_peer_info_stats.rate_stats) {
         StaRateStat rateStat;
         if (!convertLegacyWifiRateInfoToAidl(legacy_rate_stats.rate, &rateStat.rateInfo)) {
@@ -1151,7 +1157,7 @@ bool convertLegacyPeerInfoStatsToAidl(const legacy_hal::WifiPeerInfo& legacy_pee
         rateStat.retries = legacy_rate_stats.retries;
         aidlRateStats.push_back(rateStat);
     }
-    aidl_peer_info_stats->rateStats = aidlRateStats;
+    aidl_peer_info_stats->rateStats = std::move(aidlRateStats);
     return true;
 }
 
@@ -2298,6 +2304,10 @@ bool convertLegacyNanCapabilitiesResponseToAidl(const legacy_hal::NanCapabilitie
     return true;
 }
 
+// Each field below is one direct copy from the legacy C arrays into the AIDL vectors - the
+// minimum the stable types permit (the AIDL parcel owns its storage). Service-discovery match
+// filtering itself runs in NAN firmware / the vendor HAL before this indication is raised, so
+// there is no HAL-side filter evaluation to precompile.
 bool convertLegacyNanMatchIndToAidl(const legacy_hal::NanMatchInd& legacy_ind,
                                     NanMatchInd* aidl_ind) {
     if (!aidl_ind) {
@@ -1448,7 +1448,7 @@ ndk::ScopedAStatus WifiChip::registerDebugRingBufferCallback() {
 
     std::weak_ptr<WifiChip> weak_ptr_this = weak_ptr_this_;
     const auto& on_ring_buffer_data_callback =
-            [weak_ptr_this](const std::string& name, const std::vector<uint8_t>& data,
+            [weak_ptr_this](const std::string& name, std::vector<uint8_t> data,
                             const legacy_hal::wifi_ring_buffer_status& status) {
                 const auto shared_ptr_this = weak_ptr_this.lock();
                 if (!shared_ptr_this.get() || !shared_ptr_this->isValid()) {
@@ -1467,7 +1467,7 @@ ndk::ScopedAStatus WifiChip::registerDebugRingBufferCallback() {
                     const auto& target = shared_ptr_this->ringbuffer_map_.find(name);
                     if (target != shared_ptr_this->ringbuffer_map_.end()) {
                         Ringbuffer& cur_buffer = target->second;
-                        appendstatus = cur_buffer.append(data);
+                        appendstatus = cur_buffer.append(std::move(data));
                     } else {
                         LOG(ERROR) << "Ringname " << name << " not found";
                         return;
@@ -509,9 +509,10 @@ using on_rtt_results_callback_v2 =
 using on_rtt_results_callback_v3 =
         std::function<void(wifi_request_id, const std::vector<const wifi_rtt_result_v3*>&)>;
 
-// Callback for ring buffer data.
+// Callback for ring buffer data. The buffer is passed by value so the single copy made off
+// the legacy HAL's borrowed buffer can be moved through to its final destination.
 using on_ring_buffer_data_callback = std::function<void(
-        const std::string&, const std::vector<uint8_t>&, const wifi_ring_buffer_status&)>;
+        const std::string&, std::vector<uint8_t>, const wifi_ring_buffer_status&)>;
 
 // Callback for alerts.
 using on_error_alert_callback = std::function<void(int32_t, const std::vector<uint8_t>&)>;
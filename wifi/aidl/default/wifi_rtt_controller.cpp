@@ -134,6 +134,12 @@ ndk::ScopedAStatus WifiRttController::registerEventCallbackInternal(
     return ndk::ScopedAStatus::ok();
 }
 
+// Note: rangeRequest already aggregates - one call carries the whole RttConfig vector for a
+// ranging burst and the legacy HAL delivers the complete result set through a single
+// on_rtt_results callback; there is no per-peer call to batch. The call into the legacy HAL
+// is asynchronous (results arrive on the event loop thread), and streaming partial results as
+// they are measured would require both a vendor HAL event per peer and a revised AIDL
+// callback shape.
 ndk::ScopedAStatus WifiRttController::rangeRequestInternal(
         int32_t cmd_id, const std::vector<RttConfig>& rtt_configs) {
     // Try 11mc & 11az ranging (v3)
@@ -65,32 +65,43 @@ void InterceptorRelay::relayMessages() {
         }
         if (!isSocketReadable(nlsockEvents)) continue;
 
-        const auto [msgMaybe, sa] = mNlSocket->receiveFrom();
-        if (!msgMaybe.has_value()) {
-            LOG(ERROR) << "Failed to receive Netlink data!";
-            mRunning = false;
-            return;
-        }
-        const auto msg = *msgMaybe;
-        if (!msg.firstOk()) {
-            LOG(ERROR) << "Netlink packet is malformed!";
-            // Test messages might be empty, this isn't fatal.
-            continue;
-        }
-        if constexpr (kSuperVerbose) {
-            LOG(VERBOSE) << "[" << mClientName
-                         << "] nlMsg: " << nl::toString(msg, NETLINK_GENERIC);
-        }
-
-        uint32_t destinationPid = 0;
-        if (sa.nl_pid == 0) {
-            destinationPid = mClientNlPid;
-        }
-
-        if (!mNlSocket->send(msg, destinationPid)) {
-            LOG(ERROR) << "Failed to send Netlink message!";
-            mRunning = false;
-            return;
+        // Drain every message already queued on the socket before sleeping again, so a burst
+        // (e.g. an nl80211 scan-result dump) is relayed with a single poll wakeup instead of
+        // one poll round-trip per message.
+        bool moreData = true;
+        while (mRunning && moreData) {
+            const auto [msgMaybe, sa] = mNlSocket->receiveFrom();
+            if (!msgMaybe.has_value()) {
+                LOG(ERROR) << "Failed to receive Netlink data!";
+                mRunning = false;
+                return;
+            }
+            const auto msg = *msgMaybe;
+            if (msg.firstOk()) {
+                if constexpr (kSuperVerbose) {
+                    LOG(VERBOSE) << "[" << mClientName
+                                 << "] nlMsg: " << nl::toString(msg, NETLINK_GENERIC);
+                }
+
+                uint32_t destinationPid = 0;
+                if (sa.nl_pid == 0) {
+                    destinationPid = mClientNlPid;
+                }
+
+                if (!mNlSocket->send(msg, destinationPid)) {
+                    LOG(ERROR) << "Failed to send Netlink message!";
+                    mRunning = false;
+                    return;
+                }
+            } else {
+                LOG(ERROR) << "Netlink packet is malformed!";
+                // Test messages might be empty, this isn't fatal.
+            }
+
+            // Zero-timeout poll: keep draining only while data is already queued.
+            if (poll(fds, countof(fds), 0) <= 0 || !isSocketReadable(fds[0].revents)) {
+                moreData = false;
+            }
         }
     }
     LOG(VERBOSE) << "[" << mClientName << "] Exiting relay thread!";